@@ -60,6 +60,57 @@ workspace "rw-ecs"
 			"rw-ecs/include/"
 		}
         
+		links {
+			"rw-ecs"
+		}
+
+	project "rw-ecs-alloc-test"
+        kind            "ConsoleApp"
+        location        "test"
+        language        "C++"
+		
+		files {
+			"test/rw-ecs-alloc-test.cpp"
+		}
+	
+		includedirs {
+			"rw-ecs/include/"
+		}
+        
+		links {
+			"rw-ecs"
+		}
+
+	project "rw-ecs-index-test"
+        kind            "ConsoleApp"
+        location        "test"
+        language        "C++"
+		
+		files {
+			"test/rw-ecs-index-test.cpp"
+		}
+	
+		includedirs {
+			"rw-ecs/include/"
+		}
+        
+		links {
+			"rw-ecs"
+		}
+
+	project "rw-ecs-merge-test"
+        kind            "ConsoleApp"
+        location        "test"
+        language        "C++"
+		
+		files {
+			"test/rw-ecs-merge-test.cpp"
+		}
+	
+		includedirs {
+			"rw-ecs/include/"
+		}
+        
 		links {
 			"rw-ecs"
 		}
\ No newline at end of file
@@ -0,0 +1,330 @@
+#ifndef RW__ECS_COMPONENT_INDEX__H
+#define RW__ECS_COMPONENT_INDEX__H
+RW_ECS_NAMESPACE_BEGIN
+
+namespace detail {
+    template<typename T>
+    struct member_traits;
+
+    template<typename Component, typename Key>
+    struct member_traits<Key Component::*> {
+        using component_type = Component;
+        using key_type       = Key;
+    };
+}
+
+// Indices remember the key each entity was inserted with, so erasing never depends on the current component value.
+template<typename Component>
+class icomponent_index {
+public:
+    virtual ~icomponent_index() = default;
+
+    // Returns false and leaves entity out when the key may only be held once and another entity holds it.
+    virtual bool insert(entity_handle entity, const Component& component) = 0;
+    virtual void erase(entity_handle entity) = 0;
+    virtual void clear(void) = 0;
+
+    // Whether entity is indexed under the key component currently has.
+    virtual bool matches(entity_handle entity, const Component& component) const = 0;
+};
+
+// Hashed lookup of the single entity holding a key, e.g. unique_index<&NetworkId::value>.
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+class unique_index : public icomponent_index<typename detail::member_traits<decltype(Member)>::component_type> {
+public:
+    using component_type = typename detail::member_traits<decltype(Member)>::component_type;
+    using key_type       = typename detail::member_traits<decltype(Member)>::key_type;
+
+    // Returns invalid_entity when no entity holds the key.
+    entity_handle find(const key_type& key) const noexcept;
+
+    bool contains(const key_type& key) const noexcept;
+
+private:
+    bool insert(entity_handle entity, const component_type& component) override;
+    void erase(entity_handle entity) override;
+    void clear(void) override;
+    bool matches(entity_handle entity, const component_type& component) const override;
+
+private:
+    std::unordered_map<key_type, entity_handle> m_Data{};
+    std::unordered_map<entity_handle, key_type> m_Keys{};
+};
+
+// Ordered grouping of entities by key, e.g. ordered_index<&Team::value>, supports exact and range lookups.
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+class ordered_index : public icomponent_index<typename detail::member_traits<decltype(Member)>::component_type> {
+public:
+    using component_type = typename detail::member_traits<decltype(Member)>::component_type;
+    using key_type       = typename detail::member_traits<decltype(Member)>::key_type;
+
+    std::span<const entity_handle> find(const key_type& key) const noexcept;
+
+    // Calls function(entity) for every entity with a key in [first, last], in key order.
+    template<typename Function>
+    void for_each(const key_type& first, const key_type& last, Function&& function) const;
+
+private:
+    struct position {
+        key_type key;
+        size_t   index;
+    };
+
+    bool insert(entity_handle entity, const component_type& component) override;
+    void erase(entity_handle entity) override;
+    void clear(void) override;
+    bool matches(entity_handle entity, const component_type& component) const override;
+
+private:
+    std::map<key_type, std::vector<entity_handle>> m_Data{};
+    std::unordered_map<entity_handle, position>    m_Positions{};
+};
+
+template<typename Index>
+concept is_component_index = std::derived_from<Index, icomponent_index<typename Index::component_type>>;
+
+namespace detail {
+    [[noreturn]] inline void throw_duplicate_key(void) {
+        throw std::invalid_argument("unique_index: key is already held by another entity");
+    }
+}
+
+// Indices declared on one component type, kept up to date by its pool.
+// A Source provides each(function(entity, component)) over the components to index.
+template<typename Component>
+class component_index_list {
+public:
+    component_index_list() = default;
+    component_index_list(component_index_list&&) = default;
+    component_index_list& operator=(component_index_list&&) = default;
+
+    // Throws std::invalid_argument, without adding the index, when source holds a key twice that may only be held once.
+    template<is_component_index Index, typename Source>
+    Index& add(const Source& source);
+
+    template<is_component_index Index>
+    const Index& get(void) const;
+
+    bool empty(void) const noexcept;
+
+    // Either every index takes entity or none does, returns false in the latter case.
+    bool insert(entity_handle entity, const Component& component);
+    void erase(entity_handle entity);
+
+    // Reindexes every component whose key changed since it was indexed, dropping all stale entries before any insert
+    // so keys that moved between entities never collide midway. Throws std::invalid_argument at the end if an index
+    // rejected a key, the affected entities stay out of that index.
+    template<typename Source>
+    void sync(const Source& source);
+
+    // Like sync, but starts from empty indices and leaves rejected entities out without throwing.
+    template<typename Source>
+    void rebuild(const Source& source);
+
+    void swap(component_index_list& other) noexcept;
+
+private:
+    std::unordered_map<std::type_index, std::unique_ptr<icomponent_index<Component>>> m_Data{};
+
+    component_index_list(const component_index_list&) = delete;
+    component_index_list& operator=(const component_index_list&) = delete;
+};
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+entity_handle unique_index<Member>::find(const key_type& key) const noexcept {
+    auto it = m_Data.find(key);
+    return it != m_Data.end() ? it->second : invalid_entity;
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+bool unique_index<Member>::contains(const key_type& key) const noexcept {
+    return m_Data.contains(key);
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+bool unique_index<Member>::insert(entity_handle entity, const component_type& component) {
+    this->erase(entity);
+
+    if (!m_Data.try_emplace(component.*Member, entity).second) return false;
+    m_Keys.emplace(entity, component.*Member);
+    return true;
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+void unique_index<Member>::erase(entity_handle entity) {
+    auto key_it = m_Keys.find(entity);
+    if (key_it == m_Keys.end()) return;
+
+    m_Data.erase(key_it->second);
+    m_Keys.erase(key_it);
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+void unique_index<Member>::clear(void) {
+    m_Data.clear();
+    m_Keys.clear();
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+bool unique_index<Member>::matches(entity_handle entity, const component_type& component) const {
+    auto it = m_Keys.find(entity);
+    return it != m_Keys.end() && it->second == component.*Member;
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+std::span<const entity_handle> ordered_index<Member>::find(const key_type& key) const noexcept {
+    auto it = m_Data.find(key);
+    if (it == m_Data.end()) return {};
+    return { it->second.begin(), it->second.end() };
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+template<typename Function>
+void ordered_index<Member>::for_each(const key_type& first, const key_type& last, Function&& function) const {
+    auto end = m_Data.upper_bound(last);
+    for (auto it = m_Data.lower_bound(first); it != end; ++it) {
+        for (entity_handle entity : it->second) {
+            function(entity);
+        }
+    }
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+bool ordered_index<Member>::insert(entity_handle entity, const component_type& component) {
+    this->erase(entity);
+
+    std::vector<entity_handle>& group = m_Data[component.*Member];
+    m_Positions.emplace(entity, position{ component.*Member, group.size() });
+    group.push_back(entity);
+    return true;
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+void ordered_index<Member>::erase(entity_handle entity) {
+    auto position_it = m_Positions.find(entity);
+    if (position_it == m_Positions.end()) return;
+
+    auto group_it = m_Data.find(position_it->second.key);
+    std::vector<entity_handle>& group = group_it->second;
+    size_t entity_index = position_it->second.index;
+    assert(group[entity_index] == entity);
+
+    entity_handle swap_entity = group.back();
+    m_Positions.at(swap_entity).index = entity_index;
+    group[entity_index] = swap_entity;
+
+    group.pop_back();
+    m_Positions.erase(entity);
+
+    if (group.empty()) {
+        m_Data.erase(group_it);
+    }
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+void ordered_index<Member>::clear(void) {
+    m_Data.clear();
+    m_Positions.clear();
+}
+
+template<auto Member> requires std::is_member_object_pointer_v<decltype(Member)>
+bool ordered_index<Member>::matches(entity_handle entity, const component_type& component) const {
+    auto it = m_Positions.find(entity);
+    return it != m_Positions.end() && it->second.key == component.*Member;
+}
+
+template<typename Component>
+template<is_component_index Index, typename Source>
+Index& component_index_list<Component>::add(const Source& source) {
+    static_assert(std::same_as<typename Index::component_type, Component>);
+
+    auto it = m_Data.find(typeid(Index));
+    if (it != m_Data.end()) {
+        return *static_cast<Index*>(it->second.get());
+    }
+
+    std::unique_ptr<icomponent_index<Component>> base_index = std::make_unique<Index>();
+    bool rejected = false;
+    source.each([&base_index, &rejected](entity_handle entity, const Component& component) {
+        rejected |= !base_index->insert(entity, component);
+    });
+    if (rejected) {
+        detail::throw_duplicate_key();
+    }
+
+    Index& result = *static_cast<Index*>(base_index.get());
+    m_Data.emplace(typeid(Index), std::move(base_index));
+    return result;
+}
+
+template<typename Component>
+template<is_component_index Index>
+const Index& component_index_list<Component>::get(void) const {
+    return *static_cast<const Index*>(m_Data.at(typeid(Index)).get());
+}
+
+template<typename Component>
+bool component_index_list<Component>::empty(void) const noexcept {
+    return m_Data.empty();
+}
+
+template<typename Component>
+bool component_index_list<Component>::insert(entity_handle entity, const Component& component) {
+    for (auto& [type, pointer] : m_Data) {
+        if (!pointer->insert(entity, component)) {
+            this->erase(entity);
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Component>
+void component_index_list<Component>::erase(entity_handle entity) {
+    for (auto& [type, pointer] : m_Data) {
+        pointer->erase(entity);
+    }
+}
+
+template<typename Component>
+template<typename Source>
+void component_index_list<Component>::sync(const Source& source) {
+    bool rejected = false;
+    for (auto& [type, pointer] : m_Data) {
+        icomponent_index<Component>& index = *pointer;
+        source.each([&index](entity_handle entity, const Component& component) {
+            if (!index.matches(entity, component)) {
+                index.erase(entity);
+            }
+        });
+        source.each([&index, &rejected](entity_handle entity, const Component& component) {
+            if (!index.matches(entity, component)) {
+                rejected |= !index.insert(entity, component);
+            }
+        });
+    }
+    if (rejected) {
+        detail::throw_duplicate_key();
+    }
+}
+
+template<typename Component>
+template<typename Source>
+void component_index_list<Component>::rebuild(const Source& source) {
+    for (auto& [type, pointer] : m_Data) {
+        pointer->clear();
+    }
+    source.each([this](entity_handle entity, const Component& component) {
+        for (auto& [type, pointer] : m_Data) {
+            pointer->insert(entity, component);
+        }
+    });
+}
+
+template<typename Component>
+void component_index_list<Component>::swap(component_index_list& other) noexcept {
+    std::swap(m_Data, other.m_Data);
+}
+
+RW_ECS_NAMESPACE_END
+#endif
\ No newline at end of file
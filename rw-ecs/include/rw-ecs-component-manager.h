@@ -14,15 +14,51 @@ public:
     template<typename Component, typename ... Args> requires std::constructible_from<Component, Args...>
     Component& add_component(entity_handle entity, Args&& ... args);
 
+    template<typename Component, typename ... Args> requires std::constructible_from<Component, Args...>
+    error_code try_add_component(entity_handle entity, Args&& ... args);
+
     template<typename Component>
     void remove_component(entity_handle entity);
 
     template<typename Component>
     Component& get_component(entity_handle entity);
 
+    template<typename Component>
+    const Component& get_component(entity_handle entity) const;
+
+    template<is_double_buffered_component Component>
+    const Component& get_previous_component(entity_handle entity) const;
+
+    template<is_double_buffered_component Component>
+    void swap_buffers(void);
+
+    template<is_double_buffered_component Component>
+    std::span<const entity_handle> component_entities(void) const;
+
+    template<is_double_buffered_component Component>
+    std::span<const Component> previous_components(void) const;
+
+    template<is_double_buffered_component Component>
+    std::span<Component> current_components(void);
+
+    template<typename Component, typename Function>
+    void patch_component(entity_handle entity, Function&& function);
+
     template<typename Component>
     bool has_component(entity_handle entity) const noexcept;
 
+    template<typename Component, typename Function>
+    void each(Function&& function) const;
+
+    template<is_component_index Index>
+    void register_index(void);
+
+    template<is_component_index Index>
+    const Index& get_index(void) const;
+
+    template<typename Component>
+    void sync_indices(void);
+
 private:
     template<typename Component>
     component_pool<Component>& get_pool(void);
@@ -32,6 +68,12 @@ private:
 
     void destroy_entity(entity_handle entity);
 
+    void move_entities(component_manager& destination, std::span<const entity_handle> entities, std::span<const entity_handle> remap);
+    void merge(component_manager& source, std::span<const entity_handle> entities, std::span<const entity_handle> remap);
+
+    // Pairs every bounded pool of this manager with the number of components the same pool in destination can still take.
+    std::vector<std::pair<const icomponent_pool*, size_t>> free_capacity(const component_manager& destination) const;
+
 private:
     std::unordered_map<std::type_index, std::unique_ptr<icomponent_pool>> m_Data{};
 
@@ -53,6 +95,18 @@ Component& component_manager::add_component(entity_handle entity, Args&& ... arg
     return pool.push(entity, std::forward<Args>(args)...);
 }
 
+template<typename Component, typename ... Args> requires std::constructible_from<Component, Args...>
+error_code component_manager::try_add_component(entity_handle entity, Args&& ... args) {
+    component_pool<Component>& pool = this->get_pool<Component>();
+    if constexpr (is_static_component<Component>) {
+        if (pool.full() && !pool.contains(entity)) {
+            return error_code::component_capacity_exceeded;
+        }
+    }
+    pool.push(entity, std::forward<Args>(args)...);
+    return error_code::none;
+}
+
 template<typename Component>
 void component_manager::remove_component(entity_handle entity) {
     component_pool<Component>& pool = this->get_pool<Component>();
@@ -65,6 +119,48 @@ Component& component_manager::get_component(entity_handle entity) {
     return pool.get(entity);
 }
 
+template<typename Component>
+const Component& component_manager::get_component(entity_handle entity) const {
+    const component_pool<Component>& pool = this->get_pool<Component>();
+    return pool.get(entity);
+}
+
+template<is_double_buffered_component Component>
+const Component& component_manager::get_previous_component(entity_handle entity) const {
+    const component_pool<Component>& pool = this->get_pool<Component>();
+    return pool.get_previous(entity);
+}
+
+template<is_double_buffered_component Component>
+void component_manager::swap_buffers(void) {
+    component_pool<Component>& pool = this->get_pool<Component>();
+    pool.swap_buffers();
+}
+
+template<typename Component, typename Function>
+void component_manager::patch_component(entity_handle entity, Function&& function) {
+    component_pool<Component>& pool = this->get_pool<Component>();
+    pool.patch(entity, std::forward<Function>(function));
+}
+
+template<is_double_buffered_component Component>
+std::span<const entity_handle> component_manager::component_entities(void) const {
+    const component_pool<Component>& pool = this->get_pool<Component>();
+    return pool.entities();
+}
+
+template<is_double_buffered_component Component>
+std::span<const Component> component_manager::previous_components(void) const {
+    const component_pool<Component>& pool = this->get_pool<Component>();
+    return pool.previous();
+}
+
+template<is_double_buffered_component Component>
+std::span<Component> component_manager::current_components(void) {
+    component_pool<Component>& pool = this->get_pool<Component>();
+    return pool.current();
+}
+
 template<typename Component>
 bool component_manager::has_component(entity_handle entity) const noexcept {
     if (!m_Data.contains(typeid(Component))) return false;
@@ -72,6 +168,34 @@ bool component_manager::has_component(entity_handle entity) const noexcept {
     return pool.contains(entity);
 }
 
+template<typename Component, typename Function>
+void component_manager::each(Function&& function) const {
+    if (!m_Data.contains(typeid(Component))) return;
+    const component_pool<Component>& pool = this->get_pool<Component>();
+    pool.each(std::forward<Function>(function));
+}
+
+template<is_component_index Index>
+void component_manager::register_index(void) {
+    using Component = typename Index::component_type;
+    this->register_component<Component>();
+    component_pool<Component>& pool = this->get_pool<Component>();
+    pool.template add_index<Index>();
+}
+
+template<is_component_index Index>
+const Index& component_manager::get_index(void) const {
+    using Component = typename Index::component_type;
+    const component_pool<Component>& pool = this->get_pool<Component>();
+    return pool.template get_index<Index>();
+}
+
+template<typename Component>
+void component_manager::sync_indices(void) {
+    component_pool<Component>& pool = this->get_pool<Component>();
+    pool.sync_indices();
+}
+
 template<typename Component>
 component_pool<Component>& component_manager::get_pool(void) {
     std::unique_ptr<icomponent_pool>& base_pool = m_Data.at(typeid(Component));
@@ -6,10 +6,65 @@ class icomponent_pool {
 public:
     virtual ~icomponent_pool() = default;
     virtual void destroy_entity(entity_handle entity) = 0;
+
+    virtual bool contains(entity_handle entity) const noexcept = 0;
+    virtual size_t size(void) const noexcept = 0;
+
+    // Upper bound on size(), pools that grow on demand report std::numeric_limits<size_t>::max().
+    virtual size_t capacity(void) const noexcept = 0;
+    virtual std::unique_ptr<icomponent_pool> create_empty(void) const = 0;
+
+    // Moves the component of entity, if any, into destination as destination_entity. Both pools hold the same type.
+    virtual void transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) = 0;
+
+    // Takes over all components of source, a pool of the same type, rekeyed through remap. This pool must be empty.
+    virtual void splice(icomponent_pool& source, std::span<const entity_handle> remap) = 0;
+};
+
+// Secondary index bookkeeping shared by every storage policy. Pool provides get(entity) and
+// each(function(entity, component)) in storage order, and keeps m_SecondaryIndices in step with its own storage.
+// Indices see push, patch and pop right away. Writes through get or iterators only show up after sync_indices.
+// A key that may only be held once is never handed over silently: push, patch, add_index and sync_indices throw
+// std::invalid_argument when another entity holds it. push then leaves the pool unchanged, the others leave the entity
+// out of the rejecting index. Components moved in by transfer or splice are left out the same way, without throwing.
+template<typename Pool, typename Component>
+class component_pool_base : public icomponent_pool {
+public:
+    // Applies function to the component and updates the secondary indices right away.
+    template<typename Function>
+    void patch(entity_handle entity, Function&& function);
+
+    template<is_component_index Index>
+    Index& add_index(void);
+
+    template<is_component_index Index>
+    const Index& get_index(void) const;
+
+    void sync_indices(void);
+
+protected:
+    component_pool_base() = default;
+    component_pool_base(component_pool_base&&) = default;
+    component_pool_base& operator=(component_pool_base&&) = default;
+
+    // Indexes a component Pool has just stored, popping it again if its key is rejected.
+    void index_stored(entity_handle entity, const Component& component);
+
+    // Assigns value to the stored component of entity, the old value stays if the new key is rejected.
+    Component& index_replaced(entity_handle entity, Component& stored, Component&& value);
+
+protected:
+    component_index_list<Component> m_SecondaryIndices{};
+
+private:
+    component_pool_base(const component_pool_base&) = delete;
+    component_pool_base& operator=(const component_pool_base&) = delete;
 };
 
-template<typename Component>
-class component_pool : public icomponent_pool {
+template<typename Component, typename Storage = component_storage_t<Component>>
+class component_pool : public component_pool_base<component_pool<Component, Storage>, Component> {
+    static_assert(std::same_as<Storage, packed_storage>, "Unknown component storage policy");
+
 public:
     using data_type      = std::vector<Component>;
     using indices_type   = std::unordered_map<entity_handle, size_t>;
@@ -27,11 +82,26 @@ public:
     void pop(entity_handle entity);
 
     Component& get(entity_handle entity);
+    const Component& get(entity_handle entity) const;
 
-    bool contains(entity_handle entity) const noexcept;
+    bool contains(entity_handle entity) const noexcept override;
+
+    size_t size(void) const noexcept override;
+    size_t capacity(void) const noexcept override;
+
+    template<typename Function>
+    void each(Function&& function) const;
 
 private:
     void destroy_entity(entity_handle entity) override;
+    std::unique_ptr<icomponent_pool> create_empty(void) const override;
+    void transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) override;
+    void splice(icomponent_pool& source, std::span<const entity_handle> remap) override;
+
+    template<typename ... Args>
+    Component& store(entity_handle entity, Args&& ... args);
+
+    void remove(typename indices_type::iterator it);
 
 private:
     indices_type  m_Indices{};
@@ -42,17 +112,153 @@ private:
     component_pool& operator=(const component_pool&) = delete;
 };
 
-template<typename Component>
+template<typename Pool, typename Component>
+template<typename Function>
+void component_pool_base<Pool, Component>::patch(entity_handle entity, Function&& function) {
+    Component& component = static_cast<Pool&>(*this).get(entity);
+    m_SecondaryIndices.erase(entity);
+    std::forward<Function>(function)(component);
+    if (!m_SecondaryIndices.insert(entity, component)) {
+        detail::throw_duplicate_key();
+    }
+}
+
+template<typename Pool, typename Component>
+template<is_component_index Index>
+Index& component_pool_base<Pool, Component>::add_index(void) {
+    return m_SecondaryIndices.template add<Index>(static_cast<const Pool&>(*this));
+}
+
+template<typename Pool, typename Component>
+template<is_component_index Index>
+const Index& component_pool_base<Pool, Component>::get_index(void) const {
+    return m_SecondaryIndices.template get<Index>();
+}
+
+template<typename Pool, typename Component>
+void component_pool_base<Pool, Component>::sync_indices(void) {
+    m_SecondaryIndices.sync(static_cast<const Pool&>(*this));
+}
+
+template<typename Pool, typename Component>
+void component_pool_base<Pool, Component>::index_stored(entity_handle entity, const Component& component) {
+    if (!m_SecondaryIndices.insert(entity, component)) {
+        static_cast<Pool&>(*this).pop(entity);
+        detail::throw_duplicate_key();
+    }
+}
+
+template<typename Pool, typename Component>
+Component& component_pool_base<Pool, Component>::index_replaced(entity_handle entity, Component& stored, Component&& value) {
+    m_SecondaryIndices.erase(entity);
+    if (!m_SecondaryIndices.insert(entity, value)) {
+        m_SecondaryIndices.insert(entity, stored);
+        detail::throw_duplicate_key();
+    }
+    stored = std::move(value);
+    return stored;
+}
+
+template<typename Component, typename Storage>
 template<typename ... Args> requires std::constructible_from<Component, Args...>
-Component& component_pool<Component>::push(entity_handle entity, Args&& ... args) {
+Component& component_pool<Component, Storage>::push(entity_handle entity, Args&& ... args) {
     auto it = m_Indices.find(entity);
 
     if (it != m_Indices.end()) {
-        Component& result = m_Components[it->second];
-        result = Component(std::forward<Args>(args)...);
-        return result;
+        return this->index_replaced(entity, m_Components[it->second], Component(std::forward<Args>(args)...));
     }
 
+    Component& result = this->store(entity, std::forward<Args>(args)...);
+    this->index_stored(entity, result);
+    return result;
+}
+
+template<typename Component, typename Storage>
+void component_pool<Component, Storage>::pop(entity_handle entity) {
+    auto it = m_Indices.find(entity);
+    if (it == m_Indices.end()) return;
+
+    this->m_SecondaryIndices.erase(entity);
+    this->remove(it);
+}
+
+template<typename Component, typename Storage>
+Component& component_pool<Component, Storage>::get(entity_handle entity) {
+    return m_Components.at(m_Indices.at(entity));
+}
+
+template<typename Component, typename Storage>
+const Component& component_pool<Component, Storage>::get(entity_handle entity) const {
+    return m_Components.at(m_Indices.at(entity));
+}
+
+template<typename Component, typename Storage>
+bool component_pool<Component, Storage>::contains(entity_handle entity) const noexcept {
+    return m_Indices.contains(entity);
+}
+
+template<typename Component, typename Storage>
+size_t component_pool<Component, Storage>::size(void) const noexcept {
+    return m_Components.size();
+}
+
+template<typename Component, typename Storage>
+size_t component_pool<Component, Storage>::capacity(void) const noexcept {
+    return std::numeric_limits<size_t>::max();
+}
+
+template<typename Component, typename Storage>
+template<typename Function>
+void component_pool<Component, Storage>::each(Function&& function) const {
+    for (size_t index = 0; index < m_Components.size(); ++index) {
+        function(m_Entities.at(index), m_Components[index]);
+    }
+}
+
+template<typename Component, typename Storage>
+void component_pool<Component, Storage>::destroy_entity(entity_handle entity) {
+    this->pop(entity);
+}
+
+template<typename Component, typename Storage>
+std::unique_ptr<icomponent_pool> component_pool<Component, Storage>::create_empty(void) const {
+    return std::make_unique<component_pool>();
+}
+
+template<typename Component, typename Storage>
+void component_pool<Component, Storage>::transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) {
+    auto it = m_Indices.find(entity);
+    if (it == m_Indices.end()) return;
+
+    component_pool& other = static_cast<component_pool&>(destination);
+    this->m_SecondaryIndices.erase(entity);
+
+    Component& component = other.store(destination_entity, std::move(m_Components[it->second]));
+    other.m_SecondaryIndices.insert(destination_entity, component);
+    this->remove(it);
+}
+
+template<typename Component, typename Storage>
+void component_pool<Component, Storage>::splice(icomponent_pool& source, std::span<const entity_handle> remap) {
+    component_pool& other = static_cast<component_pool&>(source);
+    assert(m_Components.empty());
+
+    std::swap(m_Entities, other.m_Entities);
+    std::swap(m_Components, other.m_Components);
+    m_Indices.clear();
+    other.m_Indices.clear();
+    other.m_SecondaryIndices.rebuild(other);
+
+    for (auto& [index, entity] : m_Entities) {
+        entity = remap[entity];
+        m_Indices[entity] = index;
+    }
+    this->m_SecondaryIndices.rebuild(*this);
+}
+
+template<typename Component, typename Storage>
+template<typename ... Args>
+Component& component_pool<Component, Storage>::store(entity_handle entity, Args&& ... args) {
     size_t new_index = m_Components.size();
     m_Indices[entity] = new_index;
     m_Entities[new_index] = entity;
@@ -60,11 +266,8 @@ Component& component_pool<Component>::push(entity_handle entity, Args&& ... args
     return m_Components.emplace_back(std::forward<Args>(args)...);
 }
 
-template<typename Component>
-void component_pool<Component>::pop(entity_handle entity) {
-    auto it = m_Indices.find(entity);
-    if (it == m_Indices.end()) return;
-
+template<typename Component, typename Storage>
+void component_pool<Component, Storage>::remove(typename indices_type::iterator it) {
     size_t entity_index = it->second;
     size_t swap_index = m_Components.size() - 1;
 
@@ -73,25 +276,10 @@ void component_pool<Component>::pop(entity_handle entity) {
     m_Entities[entity_index] = swap_entity;
     std::swap(m_Components[entity_index], m_Components[swap_index]);
 
-    m_Indices.erase(entity);
-    m_Entities.erase(entity_index);
+    m_Indices.erase(it);
+    m_Entities.erase(swap_index);
     m_Components.pop_back();
 }
 
-template<typename Component>
-Component& component_pool<Component>::get(entity_handle entity) {
-    return m_Components.at(m_Indices.at(entity));
-}
-
-template<typename Component>
-bool component_pool<Component>::contains(entity_handle entity) const noexcept {
-    return m_Indices.contains(entity);
-}
-
-template<typename Component>
-void component_pool<Component>::destroy_entity(entity_handle entity) {
-    this->pop(entity);
-}
-
 RW_ECS_NAMESPACE_END
 #endif
\ No newline at end of file
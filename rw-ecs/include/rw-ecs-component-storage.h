@@ -0,0 +1,65 @@
+#ifndef RW__ECS_COMPONENT_STORAGE__H
+#define RW__ECS_COMPONENT_STORAGE__H
+RW_ECS_NAMESPACE_BEGIN
+
+// Densely packed storage, removals swap the last element into the hole.
+// References are invalidated by any add or remove on the same component type.
+struct packed_storage {
+};
+
+// Paged storage that never relocates elements, removals leave tombstones that are recycled in place.
+// References stay valid until the component itself is removed.
+template<size_t PageSize = 256>
+struct stable_storage {
+    static_assert(PageSize > 0);
+    static constexpr size_t page_size = PageSize;
+};
+
+// Packed storage with a read-only previous frame and a writable current frame sharing one entity index.
+// Swapping the buffers at frame end is O(1), afterwards the current frame holds the values of two frames ago.
+struct double_buffered_storage {
+};
+
+// Packed storage in fixed arrays inside the pool, nothing is allocated after registration.
+// Adding beyond Capacity fails instead of growing, see entity_component_system::try_add_component.
+template<size_t Capacity>
+struct static_storage {
+    static_assert(Capacity > 0);
+    static constexpr size_t capacity = Capacity;
+};
+
+// Select a policy either with a nested 'using storage_policy = ...;' in the component,
+// or by specializing component_storage for types you cannot modify.
+template<typename Component>
+struct component_storage {
+    using type = packed_storage;
+};
+
+template<typename Component> requires requires { typename Component::storage_policy; }
+struct component_storage<Component> {
+    using type = typename Component::storage_policy;
+};
+
+template<typename Component>
+using component_storage_t = typename component_storage<Component>::type;
+
+template<typename Component>
+concept is_double_buffered_component = std::same_as<component_storage_t<Component>, double_buffered_storage>;
+
+namespace detail {
+    template<typename T>
+    struct is_static_storage : std::integral_constant<bool, false>
+    {
+    };
+
+    template<size_t Capacity>
+    struct is_static_storage<static_storage<Capacity>> : std::integral_constant<bool, true>
+    {
+    };
+}
+
+template<typename Component>
+concept is_static_component = detail::is_static_storage<component_storage_t<Component>>::value;
+
+RW_ECS_NAMESPACE_END
+#endif
\ No newline at end of file
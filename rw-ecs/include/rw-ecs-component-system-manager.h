@@ -5,7 +5,7 @@ RW_ECS_NAMESPACE_BEGIN
 class component_system_manager {
 public:
     component_system_manager() = default;
-    component_system_manager(entity_component_system* ecs);
+    component_system_manager(entity_component_system* ecs, entity_handle capacity);
     component_system_manager(component_system_manager&&) = default;
     component_system_manager& operator=(component_system_manager&&) = default;
 
@@ -25,6 +25,7 @@ private:
 private:
     std::unordered_map<std::type_index, std::unique_ptr<icomponent_system>> m_Data{};
     entity_component_system*                                                m_ECS{};
+    entity_handle                                                           m_Capacity{ invalid_entity };
 
     component_system_manager(const component_system_manager&) = delete;
     component_system_manager& operator=(const component_system_manager&) = delete;
@@ -37,6 +38,9 @@ UserSystem& component_system_manager::register_system(Args&& ... args) {
     if (!m_Data.contains(typeid(UserSystem))) {
         std::unique_ptr<component_system<UserSystem>> pointer = std::make_unique<UserSystem>(std::forward<Args>(args)...);
         pointer->m_ECS = m_ECS;
+        if (m_Capacity != invalid_entity) {
+            pointer->m_Entities.reserve(m_Capacity);
+        }
         m_Data[typeid(UserSystem)] = std::move(pointer);
     }
     return this->get_system<UserSystem>();
@@ -0,0 +1,267 @@
+#ifndef RW__ECS_DOUBLE_BUFFERED_COMPONENT_POOL__H
+#define RW__ECS_DOUBLE_BUFFERED_COMPONENT_POOL__H
+RW_ECS_NAMESPACE_BEGIN
+
+template<typename Component>
+class component_pool<Component, double_buffered_storage> : public component_pool_base<component_pool<Component, double_buffered_storage>, Component> {
+    static_assert(std::copy_constructible<Component>, "Double buffered components are copied into both frames on push");
+
+public:
+    using data_type      = std::vector<Component>;
+    using indices_type   = std::unordered_map<entity_handle, size_t>;
+    using entities_type  = std::vector<entity_handle>;
+
+    component_pool() = default;
+    component_pool(component_pool&&) = default;
+    component_pool& operator=(component_pool&&) = default;
+
+    template<typename ... Args> requires std::constructible_from<Component, Args...>
+    Component& push(entity_handle entity, Args&& ... args);
+
+    void pop(entity_handle entity);
+
+    Component& get(entity_handle entity);
+    const Component& get(entity_handle entity) const;
+
+    const Component& get_previous(entity_handle entity) const;
+
+    bool contains(entity_handle entity) const noexcept override;
+
+    template<typename Function>
+    void each(Function&& function) const;
+
+    template<is_component_index Index>
+    Index& add_index(void);
+
+    size_t size(void) const noexcept override;
+    size_t capacity(void) const noexcept override;
+
+    // Both frames are indexed in parallel with entities().
+    std::span<const entity_handle> entities(void) const noexcept;
+    std::span<const Component> previous(void) const noexcept;
+    std::span<Component> current(void) noexcept;
+    std::span<const Component> current(void) const noexcept;
+
+    // O(1), each frame keeps its own secondary indices and they swap along with the buffers.
+    void swap_buffers(void) noexcept;
+
+private:
+    void destroy_entity(entity_handle entity) override;
+    std::unique_ptr<icomponent_pool> create_empty(void) const override;
+    void transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) override;
+    void splice(icomponent_pool& source, std::span<const entity_handle> remap) override;
+
+    template<typename ... Args>
+    Component& store(entity_handle entity, Args&& ... args);
+
+    void remove(typename indices_type::iterator it);
+
+    // Index source over the previous frame, the pool itself is the source for the current frame.
+    struct previous_frame {
+        const component_pool* pool;
+
+        template<typename Function>
+        void each(Function&& function) const;
+    };
+
+private:
+    indices_type  m_Indices{};
+    entities_type m_Entities{};
+    data_type     m_Previous{};
+    data_type     m_Current{};
+
+    component_index_list<Component> m_PreviousIndices{};
+
+    component_pool(const component_pool&) = delete;
+    component_pool& operator=(const component_pool&) = delete;
+};
+
+template<typename Component>
+template<typename ... Args> requires std::constructible_from<Component, Args...>
+Component& component_pool<Component, double_buffered_storage>::push(entity_handle entity, Args&& ... args) {
+    auto it = m_Indices.find(entity);
+
+    if (it != m_Indices.end()) {
+        return this->index_replaced(entity, m_Current[it->second], Component(std::forward<Args>(args)...));
+    }
+
+    Component& result = this->store(entity, std::forward<Args>(args)...);
+    this->index_stored(entity, result);
+
+    // The previous frame's indices are only read once a swap makes it current, sync_indices reports rejected keys then.
+    m_PreviousIndices.insert(entity, result);
+
+    return result;
+}
+
+template<typename Component>
+template<typename ... Args>
+Component& component_pool<Component, double_buffered_storage>::store(entity_handle entity, Args&& ... args) {
+    size_t new_index = m_Current.size();
+    m_Indices[entity] = new_index;
+    m_Entities.push_back(entity);
+
+    // A fresh component has no history, so its previous frame starts out equal to the current one.
+    Component& result = m_Current.emplace_back(std::forward<Args>(args)...);
+    m_Previous.push_back(result);
+    return result;
+}
+
+template<typename Component>
+void component_pool<Component, double_buffered_storage>::pop(entity_handle entity) {
+    auto it = m_Indices.find(entity);
+    if (it == m_Indices.end()) return;
+
+    this->m_SecondaryIndices.erase(entity);
+    m_PreviousIndices.erase(entity);
+    this->remove(it);
+}
+
+template<typename Component>
+Component& component_pool<Component, double_buffered_storage>::get(entity_handle entity) {
+    return m_Current.at(m_Indices.at(entity));
+}
+
+template<typename Component>
+const Component& component_pool<Component, double_buffered_storage>::get(entity_handle entity) const {
+    return m_Current.at(m_Indices.at(entity));
+}
+
+template<typename Component>
+const Component& component_pool<Component, double_buffered_storage>::get_previous(entity_handle entity) const {
+    return m_Previous.at(m_Indices.at(entity));
+}
+
+template<typename Component>
+bool component_pool<Component, double_buffered_storage>::contains(entity_handle entity) const noexcept {
+    return m_Indices.contains(entity);
+}
+
+template<typename Component>
+size_t component_pool<Component, double_buffered_storage>::size(void) const noexcept {
+    return m_Entities.size();
+}
+
+template<typename Component>
+size_t component_pool<Component, double_buffered_storage>::capacity(void) const noexcept {
+    return std::numeric_limits<size_t>::max();
+}
+
+template<typename Component>
+std::span<const entity_handle> component_pool<Component, double_buffered_storage>::entities(void) const noexcept {
+    return { m_Entities.begin(), m_Entities.end() };
+}
+
+template<typename Component>
+std::span<const Component> component_pool<Component, double_buffered_storage>::previous(void) const noexcept {
+    return { m_Previous.begin(), m_Previous.end() };
+}
+
+template<typename Component>
+std::span<Component> component_pool<Component, double_buffered_storage>::current(void) noexcept {
+    return { m_Current.begin(), m_Current.end() };
+}
+
+template<typename Component>
+std::span<const Component> component_pool<Component, double_buffered_storage>::current(void) const noexcept {
+    return { m_Current.begin(), m_Current.end() };
+}
+
+template<typename Component>
+void component_pool<Component, double_buffered_storage>::swap_buffers(void) noexcept {
+    m_Previous.swap(m_Current);
+    this->m_SecondaryIndices.swap(m_PreviousIndices);
+}
+
+template<typename Component>
+template<is_component_index Index>
+Index& component_pool<Component, double_buffered_storage>::add_index(void) {
+    m_PreviousIndices.template add<Index>(previous_frame{ this });
+    return component_pool_base<component_pool, Component>::template add_index<Index>();
+}
+
+template<typename Component>
+template<typename Function>
+void component_pool<Component, double_buffered_storage>::each(Function&& function) const {
+    for (size_t index = 0; index < m_Current.size(); ++index) {
+        function(m_Entities[index], m_Current[index]);
+    }
+}
+
+template<typename Component>
+void component_pool<Component, double_buffered_storage>::destroy_entity(entity_handle entity) {
+    this->pop(entity);
+}
+
+template<typename Component>
+std::unique_ptr<icomponent_pool> component_pool<Component, double_buffered_storage>::create_empty(void) const {
+    return std::make_unique<component_pool>();
+}
+
+template<typename Component>
+void component_pool<Component, double_buffered_storage>::transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) {
+    auto it = m_Indices.find(entity);
+    if (it == m_Indices.end()) return;
+
+    component_pool& other = static_cast<component_pool&>(destination);
+    size_t entity_index = it->second;
+
+    this->m_SecondaryIndices.erase(entity);
+    m_PreviousIndices.erase(entity);
+
+    Component& current = other.store(destination_entity, std::move(m_Current[entity_index]));
+    Component& previous = other.m_Previous.back();
+    previous = std::move(m_Previous[entity_index]);
+    other.m_SecondaryIndices.insert(destination_entity, current);
+    other.m_PreviousIndices.insert(destination_entity, previous);
+    this->remove(it);
+}
+
+template<typename Component>
+void component_pool<Component, double_buffered_storage>::splice(icomponent_pool& source, std::span<const entity_handle> remap) {
+    component_pool& other = static_cast<component_pool&>(source);
+    assert(m_Current.empty());
+
+    std::swap(m_Entities, other.m_Entities);
+    std::swap(m_Previous, other.m_Previous);
+    std::swap(m_Current, other.m_Current);
+    m_Indices.clear();
+    other.m_Indices.clear();
+    other.m_SecondaryIndices.rebuild(other);
+    other.m_PreviousIndices.rebuild(previous_frame{ &other });
+
+    for (size_t index = 0; index < m_Entities.size(); ++index) {
+        m_Entities[index] = remap[m_Entities[index]];
+        m_Indices[m_Entities[index]] = index;
+    }
+    this->m_SecondaryIndices.rebuild(*this);
+    m_PreviousIndices.rebuild(previous_frame{ this });
+}
+
+template<typename Component>
+void component_pool<Component, double_buffered_storage>::remove(typename indices_type::iterator it) {
+    size_t entity_index = it->second;
+    size_t swap_index = m_Current.size() - 1;
+
+    entity_handle swap_entity = m_Entities[swap_index];
+    m_Indices[swap_entity] = entity_index;
+    m_Entities[entity_index] = swap_entity;
+    std::swap(m_Previous[entity_index], m_Previous[swap_index]);
+    std::swap(m_Current[entity_index], m_Current[swap_index]);
+
+    m_Indices.erase(it);
+    m_Entities.pop_back();
+    m_Previous.pop_back();
+    m_Current.pop_back();
+}
+
+template<typename Component>
+template<typename Function>
+void component_pool<Component, double_buffered_storage>::previous_frame::each(Function&& function) const {
+    for (size_t index = 0; index < pool->m_Previous.size(); ++index) {
+        function(pool->m_Entities[index], pool->m_Previous[index]);
+    }
+}
+
+RW_ECS_NAMESPACE_END
+#endif
\ No newline at end of file
@@ -5,11 +5,20 @@ RW_ECS_NAMESPACE_BEGIN
 class entity_component_system {
 public:
     entity_component_system();
+
+    // Bounded world, at most capacity entities live at once and entity bookkeeping never allocates after construction.
+    // Combine with static_storage components for a world that does not allocate at all once registration is done.
+    explicit entity_component_system(entity_handle capacity);
     entity_component_system(entity_component_system&&) = default;
     entity_component_system& operator=(entity_component_system&&) = default;
 
+    // Returns invalid_entity when the world is at capacity.
     [[nodiscard]] entity_handle create_entity(void);
 
+    [[nodiscard]] error_code try_create_entity(entity_handle& entity);
+
+    [[nodiscard]] entity_handle capacity(void) const noexcept;
+
     [[nodiscard]] bool validate_entity(entity_handle entity) const noexcept;
 
     void destroy_entity(entity_handle entity);
@@ -20,18 +29,76 @@ public:
     template<typename Component, typename ... Args> requires std::constructible_from<Component, Args...>
     Component& add_component(entity_handle entity, Args&& ... args);
 
+    template<typename Component, typename ... Args> requires std::constructible_from<Component, Args...>
+    [[nodiscard]] error_code try_add_component(entity_handle entity, Args&& ... args);
+
     template<typename Component>
     [[nodiscard]] const Component& get_component(entity_handle entity) const;
 
+    // For a double buffered Component this is the write buffer of the current frame. After a swap it holds the
+    // value of two frames ago, so read from get_previous_component and write every element each frame.
+    // Writes through the reference bypass secondary indices until sync_indices<Component>, so several threads may
+    // write distinct components at once. Use patch_component to change an indexed field with immediate effect.
     template<typename Component>
     [[nodiscard]] Component& get_component(entity_handle entity);
 
+    template<is_double_buffered_component Component>
+    [[nodiscard]] const Component& get_previous_component(entity_handle entity) const;
+
+    // Bulk access to a double buffered Component, element i of both frames belongs to component_entities()[i].
+    // The spans stay valid until a Component is added or removed.
+    template<is_double_buffered_component Component>
+    [[nodiscard]] std::span<const entity_handle> component_entities(void) const;
+
+    template<is_double_buffered_component Component>
+    [[nodiscard]] std::span<const Component> previous_components(void) const;
+
+    template<is_double_buffered_component Component>
+    [[nodiscard]] std::span<Component> current_components(void);
+
+    // Updates the secondary indices of Component right away, throws std::invalid_argument on a taken unique key.
+    template<typename Component, typename Function>
+    void patch_component(entity_handle entity, Function&& function);
+
     template<typename Component>
     [[nodiscard]] bool has_component(entity_handle entity) const noexcept;
 
+    // Calls function(entity, component) for every Component in storage order, without a lookup per entity.
+    template<typename Component, typename Function>
+    void each(Function&& function) const;
+
     template<typename Component>
     void remove_component(entity_handle entity);
 
+    // Call once per frame, after all writers of Component are done. The frame just written becomes the previous
+    // frame and the write buffer is handed back with stale data from two frames ago. Writers must overwrite every
+    // element each frame from previous_components / get_previous_component, partial or read-modify-write updates
+    // on the write buffer silently revert to older values. The swap is O(1), secondary indices swap with the frames,
+    // so call sync_indices<Component> after writing a frame and before swapping it.
+    template<is_double_buffered_component Component>
+    void swap_component_buffers(void);
+
+    // Declares a secondary index such as unique_index<&NetworkId::value>, existing components are indexed right away.
+    template<is_component_index Index>
+    void register_index(void);
+
+    // A plain read, safe next to other readers but not next to writers of the component or sync_indices.
+    // Reflects writes through get_component or component spans only after sync_indices.
+    template<is_component_index Index>
+    [[nodiscard]] const Index& get_index(void) const;
+
+    // Reindexes every Component whose indexed key changed since it was indexed, call it at a frame boundary while no
+    // other thread touches Component. Throws std::invalid_argument if a unique key ended up on two entities.
+    template<typename Component>
+    void sync_indices(void);
+
+    // Moves entities and their components out of source into this world under fresh ids.
+    // Entities that do not fit into a bounded world, or whose static_storage components do not fit into this
+    // world's pools, stay in source untouched and map to invalid_entity.
+    entity_remap move_entities(entity_component_system& source, std::span<const entity_handle> entities);
+
+    // Moves everything out of source, component pools are handed over whole where this world has none yet.
+    entity_remap merge(entity_component_system& source);
 
     template<is_user_system UserSystem, typename ... Args> requires std::constructible_from<UserSystem, Args...>
     UserSystem& register_system(Args&& ... args);
@@ -46,6 +113,9 @@ private:
     template<is_user_system UserSystem, size_t N = 0>
     void register_system_components(void);
 
+    entity_remap create_entities(const entity_component_system& source, std::span<const entity_handle> entities, std::vector<entity_handle>& moved);
+    void finish_move(entity_component_system& source, std::span<const entity_handle> moved, std::span<const entity_handle> remap);
+
 private:
     entity_manager           m_EntityManager;
     component_system_manager m_SystemManager;
@@ -67,6 +137,15 @@ Component& entity_component_system::add_component(entity_handle entity, Args&& .
     return result;
 }
 
+template<typename Component, typename ... Args> requires std::constructible_from<Component, Args...>
+error_code entity_component_system::try_add_component(entity_handle entity, Args&& ... args) {
+    error_code result = m_ComponentManager.try_add_component<Component>(entity, std::forward<Args>(args)...);
+    if (result == error_code::none) {
+        m_SystemManager.update_entity(entity);
+    }
+    return result;
+}
+
 template<typename Component>
 void entity_component_system::remove_component(entity_handle entity) {
     m_ComponentManager.remove_component<Component>(entity);
@@ -83,11 +162,61 @@ Component& entity_component_system::get_component(entity_handle entity) {
     return m_ComponentManager.get_component<Component>(entity);
 }
 
+template<is_double_buffered_component Component>
+const Component& entity_component_system::get_previous_component(entity_handle entity) const {
+    return m_ComponentManager.get_previous_component<Component>(entity);
+}
+
+template<is_double_buffered_component Component>
+std::span<const entity_handle> entity_component_system::component_entities(void) const {
+    return m_ComponentManager.component_entities<Component>();
+}
+
+template<is_double_buffered_component Component>
+std::span<const Component> entity_component_system::previous_components(void) const {
+    return m_ComponentManager.previous_components<Component>();
+}
+
+template<is_double_buffered_component Component>
+std::span<Component> entity_component_system::current_components(void) {
+    return m_ComponentManager.current_components<Component>();
+}
+
+template<typename Component, typename Function>
+void entity_component_system::patch_component(entity_handle entity, Function&& function) {
+    m_ComponentManager.patch_component<Component>(entity, std::forward<Function>(function));
+}
+
 template<typename Component>
 bool entity_component_system::has_component(entity_handle entity) const noexcept {
     return m_ComponentManager.has_component<Component>(entity);
 }
 
+template<typename Component, typename Function>
+void entity_component_system::each(Function&& function) const {
+    m_ComponentManager.each<Component>(std::forward<Function>(function));
+}
+
+template<is_double_buffered_component Component>
+void entity_component_system::swap_component_buffers(void) {
+    m_ComponentManager.swap_buffers<Component>();
+}
+
+template<is_component_index Index>
+void entity_component_system::register_index(void) {
+    m_ComponentManager.register_index<Index>();
+}
+
+template<is_component_index Index>
+const Index& entity_component_system::get_index(void) const {
+    return m_ComponentManager.get_index<Index>();
+}
+
+template<typename Component>
+void entity_component_system::sync_indices(void) {
+    m_ComponentManager.sync_indices<Component>();
+}
+
 template<is_user_system UserSystem, typename ... Args> requires std::constructible_from<UserSystem, Args...>
 UserSystem& entity_component_system::register_system(Args&& ... args) {
     UserSystem& result = m_SystemManager.register_system<UserSystem>(std::forward<Args>(args)...);
@@ -114,5 +243,9 @@ void entity_component_system::register_system_components(void) {
     }
 }
 
+inline entity_remap move_entities(entity_component_system& source, std::span<const entity_handle> entities, entity_component_system& destination) {
+    return destination.move_entities(source, entities);
+}
+
 RW_ECS_NAMESPACE_END
 #endif
\ No newline at end of file
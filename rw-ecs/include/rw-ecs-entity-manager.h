@@ -5,16 +5,31 @@ RW_ECS_NAMESPACE_BEGIN
 class entity_manager {
 public:
     entity_manager() = default;
+    entity_manager(entity_handle capacity);
     entity_manager(entity_manager&&) = default;
     entity_manager& operator=(entity_manager&&) = default;
 
+    // Returns invalid_entity once capacity live entities exist.
     entity_handle create_entity(void);
     void destroy_entity(entity_handle entity);
     bool validate_entity(entity_handle entity) const noexcept;
 
+    entity_handle capacity(void) const noexcept;
+
+    std::span<const entity_handle> entities(void) const noexcept;
+
 private:
-    entity_pool               m_Entities{};
-    std::queue<entity_handle> m_RemovedIds{};
+    void push_removed_id(entity_handle entity);
+    entity_handle pop_removed_id(void) noexcept;
+
+private:
+    entity_pool                m_Entities{};
+    entity_handle              m_Capacity{ invalid_entity };
+
+    // Freed ids are reused oldest first. A ring buffer keeps that FIFO order without allocating in bounded worlds.
+    std::vector<entity_handle> m_RemovedIds{};
+    size_t                     m_RemovedHead{};
+    size_t                     m_RemovedCount{};
 
     entity_manager(const entity_manager&) = delete;
     entity_manager& operator=(const entity_manager&) = delete;
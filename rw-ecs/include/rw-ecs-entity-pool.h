@@ -16,6 +16,9 @@ public:
     void push(entity_handle entity);
     void pop(entity_handle entity);
 
+    // Sizes the pool for entities [0, capacity), pushing those afterwards never allocates.
+    void reserve(entity_handle capacity);
+
     bool contains(entity_handle entity) const noexcept;
 
     entity_handle count(void) const noexcept;
@@ -27,8 +30,10 @@ public:
     const_iterator end(void) const noexcept;
 
 private:
-    std::unordered_map<entity_handle, size_t> m_Indices{};
-    std::vector<entity_handle>                m_Data{};
+    static constexpr size_t invalid_index = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t>        m_Indices{};
+    std::vector<entity_handle> m_Data{};
 
     entity_pool(const entity_pool&) = delete;
     entity_pool& operator=(const entity_pool&) = delete;
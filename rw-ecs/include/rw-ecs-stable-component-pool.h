@@ -0,0 +1,364 @@
+#ifndef RW__ECS_STABLE_COMPONENT_POOL__H
+#define RW__ECS_STABLE_COMPONENT_POOL__H
+RW_ECS_NAMESPACE_BEGIN
+
+template<typename Component, size_t PageSize>
+class component_pool<Component, stable_storage<PageSize>> : public component_pool_base<component_pool<Component, stable_storage<PageSize>>, Component> {
+    template<bool Const>
+    class basic_iterator;
+
+public:
+    using indices_type   = std::unordered_map<entity_handle, size_t>;
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    component_pool() = default;
+    component_pool(component_pool&& other) noexcept;
+    component_pool& operator=(component_pool&& other) noexcept;
+    ~component_pool() override;
+
+    template<typename ... Args> requires std::constructible_from<Component, Args...>
+    Component& push(entity_handle entity, Args&& ... args);
+
+    void pop(entity_handle entity);
+
+    Component& get(entity_handle entity);
+    const Component& get(entity_handle entity) const;
+
+    bool contains(entity_handle entity) const noexcept override;
+
+    template<typename Function>
+    void each(Function&& function) const;
+
+    size_t size(void) const noexcept override;
+    size_t capacity(void) const noexcept override;
+
+    iterator begin(void) noexcept;
+    iterator end(void) noexcept;
+
+    const_iterator begin(void) const noexcept;
+    const_iterator end(void) const noexcept;
+
+private:
+    struct page {
+        alignas(Component) std::byte data[sizeof(Component) * PageSize];
+        size_t                        count{};
+    };
+
+    void destroy_entity(entity_handle entity) override;
+    std::unique_ptr<icomponent_pool> create_empty(void) const override;
+    void transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) override;
+    void splice(icomponent_pool& source, std::span<const entity_handle> remap) override;
+
+    template<typename ... Args>
+    Component& store(entity_handle entity, Args&& ... args);
+
+    void remove(typename indices_type::iterator it);
+    void grow(void);
+    void clear(void) noexcept;
+
+    void* address(size_t index) const noexcept;
+    Component* slot(size_t index) const noexcept;
+    size_t next_slot(size_t index) const noexcept;
+
+private:
+    std::vector<std::unique_ptr<page>> m_Pages{};
+    std::vector<entity_handle>         m_Entities{};
+    std::vector<size_t>                m_FreeSlots{};
+    indices_type                       m_Indices{};
+
+    component_pool(const component_pool&) = delete;
+    component_pool& operator=(const component_pool&) = delete;
+};
+
+template<typename Component, size_t PageSize>
+template<bool Const>
+class component_pool<Component, stable_storage<PageSize>>::basic_iterator {
+public:
+    using pool_type         = std::conditional_t<Const, const component_pool, component_pool>;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Component;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const Component*, Component*>;
+    using reference         = std::conditional_t<Const, const Component&, Component&>;
+
+    basic_iterator() = default;
+
+    reference operator*(void) const noexcept {
+        return *m_Pool->slot(m_Index);
+    }
+
+    pointer operator->(void) const noexcept {
+        return m_Pool->slot(m_Index);
+    }
+
+    entity_handle entity(void) const noexcept {
+        return m_Pool->m_Entities[m_Index];
+    }
+
+    basic_iterator& operator++(void) noexcept {
+        m_Index = m_Pool->next_slot(m_Index + 1);
+        return *this;
+    }
+
+    basic_iterator operator++(int) noexcept {
+        basic_iterator result = *this;
+        ++(*this);
+        return result;
+    }
+
+    bool operator==(const basic_iterator&) const noexcept = default;
+
+private:
+    basic_iterator(pool_type* pool, size_t index)
+        : m_Pool{ pool }
+        , m_Index{ index }
+    {
+    }
+
+private:
+    pool_type* m_Pool{};
+    size_t     m_Index{};
+
+    friend class component_pool;
+};
+
+template<typename Component, size_t PageSize>
+component_pool<Component, stable_storage<PageSize>>::component_pool(component_pool&& other) noexcept
+    : component_pool_base<component_pool, Component>{ std::move(other) }
+    , m_Pages{ std::exchange(other.m_Pages, {}) }
+    , m_Entities{ std::exchange(other.m_Entities, {}) }
+    , m_FreeSlots{ std::exchange(other.m_FreeSlots, {}) }
+    , m_Indices{ std::exchange(other.m_Indices, {}) }
+{
+}
+
+template<typename Component, size_t PageSize>
+component_pool<Component, stable_storage<PageSize>>& component_pool<Component, stable_storage<PageSize>>::operator=(component_pool&& other) noexcept {
+    if (this != &other) {
+        this->clear();
+        m_Pages = std::exchange(other.m_Pages, {});
+        m_Entities = std::exchange(other.m_Entities, {});
+        m_FreeSlots = std::exchange(other.m_FreeSlots, {});
+        m_Indices = std::exchange(other.m_Indices, {});
+        this->m_SecondaryIndices = std::move(other.m_SecondaryIndices);
+    }
+    return *this;
+}
+
+template<typename Component, size_t PageSize>
+component_pool<Component, stable_storage<PageSize>>::~component_pool() {
+    this->clear();
+}
+
+template<typename Component, size_t PageSize>
+template<typename ... Args> requires std::constructible_from<Component, Args...>
+Component& component_pool<Component, stable_storage<PageSize>>::push(entity_handle entity, Args&& ... args) {
+    auto it = m_Indices.find(entity);
+
+    if (it != m_Indices.end()) {
+        return this->index_replaced(entity, *this->slot(it->second), Component(std::forward<Args>(args)...));
+    }
+
+    Component& result = this->store(entity, std::forward<Args>(args)...);
+    this->index_stored(entity, result);
+    return result;
+}
+
+template<typename Component, size_t PageSize>
+template<typename ... Args>
+Component& component_pool<Component, stable_storage<PageSize>>::store(entity_handle entity, Args&& ... args) {
+    if (m_FreeSlots.empty()) {
+        this->grow();
+    }
+
+    size_t new_index = m_FreeSlots.back();
+    m_Indices[entity] = new_index;
+
+    Component* result{};
+    try {
+        result = std::construct_at(static_cast<Component*>(this->address(new_index)), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        m_Indices.erase(entity);
+        throw;
+    }
+
+    m_FreeSlots.pop_back();
+    m_Entities[new_index] = entity;
+    ++m_Pages[new_index / PageSize]->count;
+
+    return *result;
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::pop(entity_handle entity) {
+    auto it = m_Indices.find(entity);
+    if (it == m_Indices.end()) return;
+
+    this->m_SecondaryIndices.erase(entity);
+    this->remove(it);
+}
+
+template<typename Component, size_t PageSize>
+Component& component_pool<Component, stable_storage<PageSize>>::get(entity_handle entity) {
+    return *this->slot(m_Indices.at(entity));
+}
+
+template<typename Component, size_t PageSize>
+const Component& component_pool<Component, stable_storage<PageSize>>::get(entity_handle entity) const {
+    return *this->slot(m_Indices.at(entity));
+}
+
+template<typename Component, size_t PageSize>
+bool component_pool<Component, stable_storage<PageSize>>::contains(entity_handle entity) const noexcept {
+    return m_Indices.contains(entity);
+}
+
+template<typename Component, size_t PageSize>
+size_t component_pool<Component, stable_storage<PageSize>>::size(void) const noexcept {
+    return m_Indices.size();
+}
+
+template<typename Component, size_t PageSize>
+size_t component_pool<Component, stable_storage<PageSize>>::capacity(void) const noexcept {
+    return std::numeric_limits<size_t>::max();
+}
+
+template<typename Component, size_t PageSize>
+typename component_pool<Component, stable_storage<PageSize>>::iterator component_pool<Component, stable_storage<PageSize>>::begin(void) noexcept {
+    return { this, this->next_slot(0) };
+}
+
+template<typename Component, size_t PageSize>
+typename component_pool<Component, stable_storage<PageSize>>::iterator component_pool<Component, stable_storage<PageSize>>::end(void) noexcept {
+    return { this, m_Entities.size() };
+}
+
+template<typename Component, size_t PageSize>
+typename component_pool<Component, stable_storage<PageSize>>::const_iterator component_pool<Component, stable_storage<PageSize>>::begin(void) const noexcept {
+    return { this, this->next_slot(0) };
+}
+
+template<typename Component, size_t PageSize>
+typename component_pool<Component, stable_storage<PageSize>>::const_iterator component_pool<Component, stable_storage<PageSize>>::end(void) const noexcept {
+    return { this, m_Entities.size() };
+}
+
+template<typename Component, size_t PageSize>
+template<typename Function>
+void component_pool<Component, stable_storage<PageSize>>::each(Function&& function) const {
+    for (const_iterator it = this->begin(); it != this->end(); ++it) {
+        function(it.entity(), *it);
+    }
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::destroy_entity(entity_handle entity) {
+    this->pop(entity);
+}
+
+template<typename Component, size_t PageSize>
+std::unique_ptr<icomponent_pool> component_pool<Component, stable_storage<PageSize>>::create_empty(void) const {
+    return std::make_unique<component_pool>();
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) {
+    auto it = m_Indices.find(entity);
+    if (it == m_Indices.end()) return;
+
+    component_pool& other = static_cast<component_pool&>(destination);
+    this->m_SecondaryIndices.erase(entity);
+
+    Component& component = other.store(destination_entity, std::move(*this->slot(it->second)));
+    other.m_SecondaryIndices.insert(destination_entity, component);
+    this->remove(it);
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::splice(icomponent_pool& source, std::span<const entity_handle> remap) {
+    component_pool& other = static_cast<component_pool&>(source);
+    assert(m_Indices.empty());
+
+    // Pages change owner as a whole, so components keep their addresses across the splice.
+    std::swap(m_Pages, other.m_Pages);
+    std::swap(m_Entities, other.m_Entities);
+    std::swap(m_FreeSlots, other.m_FreeSlots);
+    m_Indices.clear();
+    other.m_Indices.clear();
+    other.m_SecondaryIndices.rebuild(other);
+
+    for (size_t index = this->next_slot(0); index < m_Entities.size(); index = this->next_slot(index + 1)) {
+        m_Entities[index] = remap[m_Entities[index]];
+        m_Indices[m_Entities[index]] = index;
+    }
+    this->m_SecondaryIndices.rebuild(*this);
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::remove(typename indices_type::iterator it) {
+    size_t entity_index = it->second;
+    std::destroy_at(this->slot(entity_index));
+
+    m_Entities[entity_index] = invalid_entity;
+    --m_Pages[entity_index / PageSize]->count;
+    m_FreeSlots.push_back(entity_index);
+    m_Indices.erase(it);
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::grow(void) {
+    size_t first_index = m_Entities.size();
+
+    m_Pages.push_back(std::make_unique<page>());
+    m_Entities.resize(first_index + PageSize, invalid_entity);
+    m_FreeSlots.reserve(m_FreeSlots.size() + PageSize);
+
+    // Hand out the lowest slot first, so new pages fill front to back.
+    for (size_t index = first_index + PageSize; index > first_index; --index) {
+        m_FreeSlots.push_back(index - 1);
+    }
+}
+
+template<typename Component, size_t PageSize>
+void component_pool<Component, stable_storage<PageSize>>::clear(void) noexcept {
+    for (size_t index = this->next_slot(0); index < m_Entities.size(); index = this->next_slot(index + 1)) {
+        std::destroy_at(this->slot(index));
+    }
+
+    m_Pages.clear();
+    m_Entities.clear();
+    m_FreeSlots.clear();
+    m_Indices.clear();
+}
+
+template<typename Component, size_t PageSize>
+void* component_pool<Component, stable_storage<PageSize>>::address(size_t index) const noexcept {
+    return m_Pages[index / PageSize]->data + (index % PageSize) * sizeof(Component);
+}
+
+template<typename Component, size_t PageSize>
+Component* component_pool<Component, stable_storage<PageSize>>::slot(size_t index) const noexcept {
+    return std::launder(static_cast<Component*>(this->address(index)));
+}
+
+template<typename Component, size_t PageSize>
+size_t component_pool<Component, stable_storage<PageSize>>::next_slot(size_t index) const noexcept {
+    while (index < m_Entities.size()) {
+        if (m_Pages[index / PageSize]->count == 0) {
+            // Whole page is tombstones, skip straight to the next one.
+            index = (index / PageSize + 1) * PageSize;
+        }
+        else if (m_Entities[index] == invalid_entity) {
+            ++index;
+        }
+        else {
+            return index;
+        }
+    }
+    return m_Entities.size();
+}
+
+RW_ECS_NAMESPACE_END
+#endif
\ No newline at end of file
@@ -0,0 +1,269 @@
+#ifndef RW__ECS_STATIC_COMPONENT_POOL__H
+#define RW__ECS_STATIC_COMPONENT_POOL__H
+RW_ECS_NAMESPACE_BEGIN
+
+template<typename Component, size_t Capacity>
+class component_pool<Component, static_storage<Capacity>> : public component_pool_base<component_pool<Component, static_storage<Capacity>>, Component> {
+public:
+    using iterator       = Component*;
+    using const_iterator = const Component*;
+
+    component_pool() = default;
+    ~component_pool() override;
+
+    // Throws std::length_error when a new entity does not fit, check full() first to avoid that.
+    template<typename ... Args> requires std::constructible_from<Component, Args...>
+    Component& push(entity_handle entity, Args&& ... args);
+
+    void pop(entity_handle entity);
+
+    Component& get(entity_handle entity);
+    const Component& get(entity_handle entity) const;
+
+    bool contains(entity_handle entity) const noexcept override;
+
+    template<typename Function>
+    void each(Function&& function) const;
+
+    size_t size(void) const noexcept override;
+    size_t capacity(void) const noexcept override;
+    bool full(void) const noexcept;
+
+    iterator begin(void) noexcept;
+    iterator end(void) noexcept;
+
+    const_iterator begin(void) const noexcept;
+    const_iterator end(void) const noexcept;
+
+private:
+    // Open addressing with linear probing, kept at most half full.
+    static constexpr size_t bucket_count = std::bit_ceil(Capacity * 2);
+    static constexpr size_t bucket_mask  = bucket_count - 1;
+
+    struct bucket {
+        entity_handle entity{ invalid_entity };
+        size_t        index{};
+    };
+
+    void destroy_entity(entity_handle entity) override;
+    std::unique_ptr<icomponent_pool> create_empty(void) const override;
+    void transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) override;
+    void splice(icomponent_pool& source, std::span<const entity_handle> remap) override;
+
+    template<typename ... Args>
+    Component& store(entity_handle entity, Args&& ... args);
+
+    void remove(size_t hole);
+    size_t find_bucket(entity_handle entity) const noexcept;
+    static size_t home_bucket(entity_handle entity) noexcept;
+
+    Component* data(void) const noexcept;
+
+private:
+    alignas(Component) mutable std::byte     m_Storage[sizeof(Component) * Capacity];
+    std::array<entity_handle, Capacity>      m_Entities{};
+    std::array<bucket, bucket_count>         m_Buckets{};
+    size_t                                   m_Count{};
+
+    component_pool(const component_pool&) = delete;
+    component_pool& operator=(const component_pool&) = delete;
+    component_pool(component_pool&&) = delete;
+    component_pool& operator=(component_pool&&) = delete;
+};
+
+template<typename Component, size_t Capacity>
+component_pool<Component, static_storage<Capacity>>::~component_pool() {
+    std::destroy(this->data(), this->data() + m_Count);
+}
+
+template<typename Component, size_t Capacity>
+template<typename ... Args> requires std::constructible_from<Component, Args...>
+Component& component_pool<Component, static_storage<Capacity>>::push(entity_handle entity, Args&& ... args) {
+    assert(entity != invalid_entity);
+    size_t position = this->find_bucket(entity);
+
+    if (m_Buckets[position].entity == entity) {
+        return this->index_replaced(entity, this->data()[m_Buckets[position].index], Component(std::forward<Args>(args)...));
+    }
+
+    if (this->full()) {
+        throw std::length_error("component_pool: static capacity exceeded");
+    }
+
+    Component& result = this->store(entity, std::forward<Args>(args)...);
+    this->index_stored(entity, result);
+    return result;
+}
+
+template<typename Component, size_t Capacity>
+template<typename ... Args>
+Component& component_pool<Component, static_storage<Capacity>>::store(entity_handle entity, Args&& ... args) {
+    assert(!this->full());
+    size_t new_index = m_Count;
+    Component* result = std::construct_at(reinterpret_cast<Component*>(m_Storage) + new_index, std::forward<Args>(args)...);
+
+    m_Buckets[this->find_bucket(entity)] = { entity, new_index };
+    m_Entities[new_index] = entity;
+    ++m_Count;
+
+    return *result;
+}
+
+template<typename Component, size_t Capacity>
+void component_pool<Component, static_storage<Capacity>>::pop(entity_handle entity) {
+    if (!this->contains(entity)) return;
+    size_t hole = this->find_bucket(entity);
+
+    this->m_SecondaryIndices.erase(entity);
+    this->remove(hole);
+}
+
+template<typename Component, size_t Capacity>
+void component_pool<Component, static_storage<Capacity>>::remove(size_t hole) {
+    size_t entity_index = m_Buckets[hole].index;
+    size_t swap_index = m_Count - 1;
+
+    if (entity_index != swap_index) {
+        entity_handle swap_entity = m_Entities[swap_index];
+        m_Buckets[this->find_bucket(swap_entity)].index = entity_index;
+        m_Entities[entity_index] = swap_entity;
+        this->data()[entity_index] = std::move(this->data()[swap_index]);
+    }
+
+    std::destroy_at(this->data() + swap_index);
+    --m_Count;
+
+    // Backward shift deletion, pulls displaced entries into the hole so probes never need tombstones.
+    for (size_t next = (hole + 1) & bucket_mask; m_Buckets[next].entity != invalid_entity; next = (next + 1) & bucket_mask) {
+        size_t home = home_bucket(m_Buckets[next].entity);
+        if (((next - home) & bucket_mask) >= ((next - hole) & bucket_mask)) {
+            m_Buckets[hole] = m_Buckets[next];
+            hole = next;
+        }
+    }
+    m_Buckets[hole] = {};
+}
+
+template<typename Component, size_t Capacity>
+Component& component_pool<Component, static_storage<Capacity>>::get(entity_handle entity) {
+    const bucket& result = m_Buckets[this->find_bucket(entity)];
+    if (entity == invalid_entity || result.entity != entity) {
+        throw std::out_of_range("component_pool: entity has no component");
+    }
+    return this->data()[result.index];
+}
+
+template<typename Component, size_t Capacity>
+const Component& component_pool<Component, static_storage<Capacity>>::get(entity_handle entity) const {
+    const bucket& result = m_Buckets[this->find_bucket(entity)];
+    if (entity == invalid_entity || result.entity != entity) {
+        throw std::out_of_range("component_pool: entity has no component");
+    }
+    return this->data()[result.index];
+}
+
+template<typename Component, size_t Capacity>
+bool component_pool<Component, static_storage<Capacity>>::contains(entity_handle entity) const noexcept {
+    return entity != invalid_entity && m_Buckets[this->find_bucket(entity)].entity == entity;
+}
+
+template<typename Component, size_t Capacity>
+size_t component_pool<Component, static_storage<Capacity>>::size(void) const noexcept {
+    return m_Count;
+}
+
+template<typename Component, size_t Capacity>
+size_t component_pool<Component, static_storage<Capacity>>::capacity(void) const noexcept {
+    return Capacity;
+}
+
+template<typename Component, size_t Capacity>
+bool component_pool<Component, static_storage<Capacity>>::full(void) const noexcept {
+    return m_Count == Capacity;
+}
+
+template<typename Component, size_t Capacity>
+typename component_pool<Component, static_storage<Capacity>>::iterator component_pool<Component, static_storage<Capacity>>::begin(void) noexcept {
+    return this->data();
+}
+
+template<typename Component, size_t Capacity>
+typename component_pool<Component, static_storage<Capacity>>::iterator component_pool<Component, static_storage<Capacity>>::end(void) noexcept {
+    return this->data() + m_Count;
+}
+
+template<typename Component, size_t Capacity>
+typename component_pool<Component, static_storage<Capacity>>::const_iterator component_pool<Component, static_storage<Capacity>>::begin(void) const noexcept {
+    return this->data();
+}
+
+template<typename Component, size_t Capacity>
+typename component_pool<Component, static_storage<Capacity>>::const_iterator component_pool<Component, static_storage<Capacity>>::end(void) const noexcept {
+    return this->data() + m_Count;
+}
+
+template<typename Component, size_t Capacity>
+template<typename Function>
+void component_pool<Component, static_storage<Capacity>>::each(Function&& function) const {
+    for (size_t index = 0; index < m_Count; ++index) {
+        function(m_Entities[index], this->data()[index]);
+    }
+}
+
+template<typename Component, size_t Capacity>
+void component_pool<Component, static_storage<Capacity>>::destroy_entity(entity_handle entity) {
+    this->pop(entity);
+}
+
+template<typename Component, size_t Capacity>
+std::unique_ptr<icomponent_pool> component_pool<Component, static_storage<Capacity>>::create_empty(void) const {
+    return std::make_unique<component_pool>();
+}
+
+template<typename Component, size_t Capacity>
+void component_pool<Component, static_storage<Capacity>>::transfer(entity_handle entity, icomponent_pool& destination, entity_handle destination_entity) {
+    if (!this->contains(entity)) return;
+    size_t hole = this->find_bucket(entity);
+
+    component_pool& other = static_cast<component_pool&>(destination);
+    this->m_SecondaryIndices.erase(entity);
+
+    Component& component = other.store(destination_entity, std::move(this->data()[m_Buckets[hole].index]));
+    other.m_SecondaryIndices.insert(destination_entity, component);
+    this->remove(hole);
+}
+
+template<typename Component, size_t Capacity>
+void component_pool<Component, static_storage<Capacity>>::splice(icomponent_pool& source, std::span<const entity_handle> remap) {
+    component_pool& other = static_cast<component_pool&>(source);
+    assert(m_Count == 0);
+
+    // Fixed arrays cannot change owner, move element wise from the back so nothing gets swapped around.
+    while (other.m_Count > 0) {
+        entity_handle entity = other.m_Entities[other.m_Count - 1];
+        other.transfer(entity, *this, remap[entity]);
+    }
+}
+
+template<typename Component, size_t Capacity>
+size_t component_pool<Component, static_storage<Capacity>>::find_bucket(entity_handle entity) const noexcept {
+    size_t position = home_bucket(entity);
+    while (m_Buckets[position].entity != invalid_entity && m_Buckets[position].entity != entity) {
+        position = (position + 1) & bucket_mask;
+    }
+    return position;
+}
+
+template<typename Component, size_t Capacity>
+size_t component_pool<Component, static_storage<Capacity>>::home_bucket(entity_handle entity) noexcept {
+    // Entity ids are handed out densely, so the id itself already spreads well.
+    return static_cast<size_t>(entity) & bucket_mask;
+}
+
+template<typename Component, size_t Capacity>
+Component* component_pool<Component, static_storage<Capacity>>::data(void) const noexcept {
+    return std::launder(reinterpret_cast<Component*>(m_Storage));
+}
+
+RW_ECS_NAMESPACE_END
+#endif
\ No newline at end of file
@@ -2,13 +2,21 @@
 #define RW__ECS__H
 
 #include <cstdint>
+#include <cstddef>
 #include <vector>
+#include <array>
 #include <unordered_map>
+#include <map>
 #include <memory>
+#include <new>
+#include <iterator>
+#include <utility>
 #include <typeindex>
-#include <queue>
 #include <span>
 #include <limits>
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
 #include <cassert>
 
 #ifndef RW_NAMESPACE
@@ -28,11 +36,25 @@ RW_ECS_NAMESPACE_BEGIN
 // Adjust me as needed:
 using entity_handle = uint32_t;
 
+// Indexed by source entity, holds the destination entity or invalid_entity when it was not moved.
+using entity_remap = std::vector<entity_handle>;
+
+enum class error_code : uint8_t {
+    none,
+    entity_capacity_exceeded,
+    component_capacity_exceeded
+};
+
 RW_ECS_NAMESPACE_END
 
 #include "rw-ecs-entity-pool.h"
 #include "rw-ecs-entity-manager.h"
+#include "rw-ecs-component-storage.h"
+#include "rw-ecs-component-index.h"
 #include "rw-ecs-component-pool.h"
+#include "rw-ecs-stable-component-pool.h"
+#include "rw-ecs-double-buffered-component-pool.h"
+#include "rw-ecs-static-component-pool.h"
 #include "rw-ecs-component-manager.h"
 #include "rw-ecs-component-system.h"
 #include "rw-ecs-component-system-manager.h"
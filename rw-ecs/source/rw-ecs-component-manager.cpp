@@ -7,4 +7,47 @@ void component_manager::destroy_entity(entity_handle entity) {
     }
 }
 
+void component_manager::move_entities(component_manager& destination, std::span<const entity_handle> entities, std::span<const entity_handle> remap) {
+    for (auto& [type, pointer] : m_Data) {
+        std::unique_ptr<icomponent_pool>& destination_pool = destination.m_Data[type];
+        if (!destination_pool) {
+            destination_pool = pointer->create_empty();
+        }
+        for (entity_handle entity : entities) {
+            pointer->transfer(entity, *destination_pool, remap[entity]);
+        }
+    }
+}
+
+void component_manager::merge(component_manager& source, std::span<const entity_handle> entities, std::span<const entity_handle> remap) {
+    for (auto& [type, pointer] : source.m_Data) {
+        std::unique_ptr<icomponent_pool>& destination_pool = m_Data[type];
+        if (!destination_pool) {
+            destination_pool = pointer->create_empty();
+        }
+
+        // Hand the whole storage over when nothing is here yet, otherwise move one component at a time.
+        if (destination_pool->size() == 0) {
+            destination_pool->splice(*pointer, remap);
+        }
+        else {
+            for (entity_handle entity : entities) {
+                pointer->transfer(entity, *destination_pool, remap[entity]);
+            }
+        }
+    }
+}
+
+std::vector<std::pair<const icomponent_pool*, size_t>> component_manager::free_capacity(const component_manager& destination) const {
+    std::vector<std::pair<const icomponent_pool*, size_t>> result{};
+    for (const auto& [type, pointer] : m_Data) {
+        if (pointer->capacity() == std::numeric_limits<size_t>::max()) continue;
+
+        auto it = destination.m_Data.find(type);
+        size_t used = it != destination.m_Data.end() ? it->second->size() : 0;
+        result.emplace_back(pointer.get(), pointer->capacity() - used);
+    }
+    return result;
+}
+
 RW_ECS_NAMESPACE_END
\ No newline at end of file
@@ -1,9 +1,10 @@
 #include "rw-ecs.h"
 RW_ECS_NAMESPACE_BEGIN
 
-component_system_manager::component_system_manager(entity_component_system* ecs)
+component_system_manager::component_system_manager(entity_component_system* ecs, entity_handle capacity)
     : m_Data{}
     , m_ECS{ ecs }
+    , m_Capacity{ capacity }
 {
 }
 
@@ -2,9 +2,14 @@
 RW_ECS_NAMESPACE_BEGIN
 
 entity_component_system::entity_component_system()
-    : m_EntityManager{}
+    : entity_component_system{ invalid_entity }
+{
+}
+
+entity_component_system::entity_component_system(entity_handle capacity)
+    : m_EntityManager{ capacity }
+    , m_SystemManager{ this, capacity }
     , m_ComponentManager{}
-    , m_SystemManager{ this }
 {
 }
 
@@ -12,6 +17,86 @@ entity_handle entity_component_system::create_entity(void) {
     return m_EntityManager.create_entity();
 }
 
+error_code entity_component_system::try_create_entity(entity_handle& entity) {
+    entity = m_EntityManager.create_entity();
+    return entity != invalid_entity ? error_code::none : error_code::entity_capacity_exceeded;
+}
+
+entity_handle entity_component_system::capacity(void) const noexcept {
+    return m_EntityManager.capacity();
+}
+
+entity_remap entity_component_system::move_entities(entity_component_system& source, std::span<const entity_handle> entities) {
+    assert(&source != this);
+
+    std::vector<entity_handle> moved{};
+    entity_remap result = this->create_entities(source, entities, moved);
+
+    source.m_ComponentManager.move_entities(m_ComponentManager, moved, result);
+    this->finish_move(source, moved, result);
+    return result;
+}
+
+entity_remap entity_component_system::merge(entity_component_system& source) {
+    assert(&source != this);
+
+    std::span<const entity_handle> entities = source.m_EntityManager.entities();
+    std::vector<entity_handle> moved{};
+    entity_remap result = this->create_entities(source, entities, moved);
+
+    // Pools can only be handed over whole if every source entity got an id here.
+    if (moved.size() == entities.size()) {
+        m_ComponentManager.merge(source.m_ComponentManager, moved, result);
+    }
+    else {
+        source.m_ComponentManager.move_entities(m_ComponentManager, moved, result);
+    }
+    this->finish_move(source, moved, result);
+    return result;
+}
+
+entity_remap entity_component_system::create_entities(const entity_component_system& source, std::span<const entity_handle> entities, std::vector<entity_handle>& moved) {
+    entity_handle max_entity = 0;
+    for (entity_handle entity : entities) {
+        if (source.validate_entity(entity)) {
+            max_entity = std::max(max_entity, entity);
+        }
+    }
+
+    entity_remap result(static_cast<size_t>(max_entity) + 1, invalid_entity);
+    moved.reserve(entities.size());
+
+    // Static pools cannot grow, so an entity is only taken if every one of its bounded components still fits.
+    std::vector<std::pair<const icomponent_pool*, size_t>> free_capacity = source.m_ComponentManager.free_capacity(m_ComponentManager);
+    auto fits = [&free_capacity](entity_handle entity) {
+        return std::ranges::all_of(free_capacity, [entity](const auto& pool) {
+            return pool.second > 0 || !pool.first->contains(entity);
+        });
+    };
+
+    for (entity_handle entity : entities) {
+        if (!source.validate_entity(entity) || result[entity] != invalid_entity || !fits(entity)) continue;
+
+        entity_handle new_entity = m_EntityManager.create_entity();
+        if (new_entity == invalid_entity) break;
+
+        for (auto& [pool, count] : free_capacity) {
+            if (pool->contains(entity)) --count;
+        }
+        result[entity] = new_entity;
+        moved.push_back(entity);
+    }
+    return result;
+}
+
+void entity_component_system::finish_move(entity_component_system& source, std::span<const entity_handle> moved, std::span<const entity_handle> remap) {
+    for (entity_handle entity : moved) {
+        source.m_SystemManager.destroy_entity(entity);
+        source.m_EntityManager.destroy_entity(entity);
+        m_SystemManager.update_entity(remap[entity]);
+    }
+}
+
 void entity_component_system::destroy_entity(entity_handle entity) {
     m_SystemManager.destroy_entity(entity);
     m_ComponentManager.destroy_entity(entity);
@@ -1,26 +1,66 @@
 #include "rw-ecs.h"
 RW_ECS_NAMESPACE_BEGIN
 
+entity_manager::entity_manager(entity_handle capacity)
+    : m_Entities{}
+    , m_Capacity{ capacity }
+    , m_RemovedIds{}
+{
+    if (m_Capacity != invalid_entity) {
+        m_Entities.reserve(m_Capacity);
+        m_RemovedIds.resize(m_Capacity);
+    }
+}
+
 entity_handle entity_manager::create_entity(void) {
     entity_handle result;
-    if (m_RemovedIds.size()) {
-        result = m_RemovedIds.front();
-        m_RemovedIds.pop();
+    if (m_RemovedCount) {
+        result = this->pop_removed_id();
     }
-    else {
+    else if (m_Entities.count() < m_Capacity) {
         result = m_Entities.count();
     }
+    else {
+        return invalid_entity;
+    }
     m_Entities.push(result);
     return result;
 }
 
 void entity_manager::destroy_entity(entity_handle entity) {
+    if (!m_Entities.contains(entity)) return;
     m_Entities.pop(entity);
-    m_RemovedIds.push(entity);
+    this->push_removed_id(entity);
 }
 
 bool entity_manager::validate_entity(entity_handle entity) const noexcept {
     return m_Entities.contains(entity);
 }
 
+entity_handle entity_manager::capacity(void) const noexcept {
+    return m_Capacity;
+}
+
+std::span<const entity_handle> entity_manager::entities(void) const noexcept {
+    return { m_Entities.begin(), m_Entities.end() };
+}
+
+void entity_manager::push_removed_id(entity_handle entity) {
+    // Bounded worlds size the ring to their capacity up front, so only unbounded worlds ever grow it.
+    if (m_RemovedCount == m_RemovedIds.size()) {
+        std::rotate(m_RemovedIds.begin(), m_RemovedIds.begin() + m_RemovedHead, m_RemovedIds.end());
+        m_RemovedIds.resize(std::max<size_t>(m_RemovedIds.size() * 2, 16));
+        m_RemovedHead = 0;
+    }
+    m_RemovedIds[(m_RemovedHead + m_RemovedCount) % m_RemovedIds.size()] = entity;
+    ++m_RemovedCount;
+}
+
+entity_handle entity_manager::pop_removed_id(void) noexcept {
+    entity_handle result = m_RemovedIds[m_RemovedHead];
+    m_RemovedHead = (m_RemovedHead + 1) % m_RemovedIds.size();
+    --m_RemovedCount;
+    return result;
+}
+
 RW_ECS_NAMESPACE_END
\ No newline at end of file
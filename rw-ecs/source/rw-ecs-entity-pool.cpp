@@ -2,29 +2,39 @@
 RW_ECS_NAMESPACE_BEGIN
 
 void entity_pool::push(entity_handle entity) {
-    if (!m_Indices.contains(entity)) {
+    assert(entity != invalid_entity);
+    if (entity >= m_Indices.size()) {
+        m_Indices.resize(static_cast<size_t>(entity) + 1, invalid_index);
+    }
+    if (m_Indices[entity] == invalid_index) {
         m_Indices[entity] = m_Data.size();
         m_Data.push_back(entity);
     }
 }
 
 void entity_pool::pop(entity_handle entity) {
-    auto it = m_Indices.find(entity);
-    if (it == m_Indices.end()) return;
+    if (!this->contains(entity)) return;
 
-    size_t entity_index = it->second;
+    size_t entity_index = m_Indices[entity];
     size_t swap_index = m_Data.size() - 1;
 
     entity_handle& swap_entity = m_Data[swap_index];
     m_Indices[swap_entity] = entity_index;
     std::swap(swap_entity, m_Data[entity_index]);
 
-    m_Indices.erase(entity);
+    m_Indices[entity] = invalid_index;
     m_Data.pop_back();
 }
 
+void entity_pool::reserve(entity_handle capacity) {
+    if (capacity > m_Indices.size()) {
+        m_Indices.resize(capacity, invalid_index);
+    }
+    m_Data.reserve(capacity);
+}
+
 bool entity_pool::contains(entity_handle entity) const noexcept {
-    return m_Indices.contains(entity);
+    return entity < m_Indices.size() && m_Indices[entity] != invalid_index;
 }
 
 entity_handle entity_pool::count(void) const noexcept {
@@ -0,0 +1 @@
+#include "rw-ecs.h"
\ No newline at end of file
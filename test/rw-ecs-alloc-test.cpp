@@ -0,0 +1,82 @@
+#include "rw-ecs.h"
+#include <cstdlib>
+#include <iostream>
+using namespace rw::ecs;
+
+static size_t g_Allocations = 0;
+
+void* operator new(size_t size) {
+    ++g_Allocations;
+    if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+constexpr entity_handle entity_capacity = 64;
+
+struct PositionComponent {
+    using storage_policy = static_storage<entity_capacity>;
+    float x, y;
+};
+
+struct VelocityComponent {
+    using storage_policy = static_storage<entity_capacity / 2>;
+    float dx, dy;
+};
+
+class MovementSystem : public component_system<MovementSystem> {
+public:
+    using component_list = std::tuple<PositionComponent, VelocityComponent>;
+};
+
+int main() {
+    entity_component_system ecs{ entity_capacity };
+    ecs.register_system<MovementSystem>();
+
+    entity_handle entities[entity_capacity]{};
+    size_t allocations = g_Allocations;
+
+    for (int cycle = 0; cycle < 100; ++cycle) {
+        for (entity_handle index = 0; index < entity_capacity; ++index) {
+            entity_handle& entity = entities[index];
+            if (ecs.try_create_entity(entity) != error_code::none) {
+                std::cout << "Entity capacity exceeded too early\n";
+                return 1;
+            }
+            if (ecs.try_add_component<PositionComponent>(entity, 1.0f, 2.0f) != error_code::none) {
+                std::cout << "Position capacity exceeded too early\n";
+                return 1;
+            }
+
+            error_code expected = index < entity_capacity / 2 ? error_code::none : error_code::component_capacity_exceeded;
+            if (ecs.try_add_component<VelocityComponent>(entity, 3.0f, 4.0f) != expected) {
+                std::cout << "Velocity capacity not enforced\n";
+                return 1;
+            }
+        }
+
+        entity_handle overflow{};
+        if (ecs.try_create_entity(overflow) != error_code::entity_capacity_exceeded) {
+            std::cout << "Entity capacity not enforced\n";
+            return 1;
+        }
+
+        for (entity_handle index = 0; index < entity_capacity; index += 3) {
+            ecs.remove_component<PositionComponent>(entities[index]);
+        }
+        for (entity_handle index = 0; index < entity_capacity; ++index) {
+            ecs.destroy_entity(entities[(index * 7) % entity_capacity]);
+        }
+    }
+
+    size_t result = g_Allocations - allocations;
+    std::cout << "Allocations after construction: " << result << '\n';
+    return result == 0 ? 0 : 1;
+}
\ No newline at end of file
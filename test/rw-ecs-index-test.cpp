@@ -0,0 +1,198 @@
+#include "rw-ecs.h"
+#include <algorithm>
+#include <iostream>
+using namespace rw::ecs;
+
+static int g_Failures = 0;
+
+static void check(bool condition, const char* message) {
+    if (!condition) {
+        std::cout << "Failed: " << message << '\n';
+        ++g_Failures;
+    }
+}
+
+static bool same_entities(std::span<const entity_handle> found, std::vector<entity_handle> expected) {
+    std::vector<entity_handle> sorted{ found.begin(), found.end() };
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(expected.begin(), expected.end());
+    return sorted == expected;
+}
+
+struct NetIdComponent {
+    int value;
+};
+
+struct PackedTeamComponent {
+    int value;
+};
+
+struct StableTeamComponent {
+    using storage_policy = stable_storage<4>;
+    int value;
+};
+
+struct StaticTeamComponent {
+    using storage_policy = static_storage<16>;
+    int value;
+};
+
+struct HealthComponent {
+    using storage_policy = double_buffered_storage;
+    int value;
+};
+
+template<typename Team>
+void test_ordered_index(void) {
+    using index_type = ordered_index<&Team::value>;
+
+    entity_component_system ecs{};
+    ecs.register_index<index_type>();
+    const index_type& index = ecs.get_index<index_type>();
+
+    entity_handle a = ecs.create_entity();
+    entity_handle b = ecs.create_entity();
+    entity_handle c = ecs.create_entity();
+    ecs.add_component<Team>(a, 3);
+    ecs.add_component<Team>(b, 3);
+    ecs.add_component<Team>(c, 5);
+    check(same_entities(index.find(3), { a, b }), "ordered lookup after add");
+    check(same_entities(index.find(5), { c }), "ordered lookup of a single entity");
+
+    ecs.patch_component<Team>(a, [](Team& team) { team.value = 5; });
+    check(same_entities(index.find(3), { b }), "ordered lookup of the old key after patch");
+    check(same_entities(index.find(5), { a, c }), "ordered lookup of the new key after patch");
+
+    // The key changes behind the index's back, removal must still drop the entry it was indexed under.
+    ecs.get_component<Team>(c).value = 3;
+    ecs.remove_component<Team>(c);
+    check(same_entities(index.find(5), { a }), "ordered removal after an unsynced write");
+    check(same_entities(index.find(3), { b }), "ordered removal leaves other entities alone");
+
+    ecs.get_component<Team>(b).value = 7;
+    check(same_entities(index.find(3), { b }), "ordered index is unchanged until sync");
+    ecs.sync_indices<Team>();
+    check(index.find(3).empty(), "ordered lookup of the old key after sync");
+    check(same_entities(index.find(7), { b }), "ordered lookup of the new key after sync");
+
+    std::vector<entity_handle> range{};
+    index.for_each(4, 8, [&range](entity_handle entity) { range.push_back(entity); });
+    check(range == std::vector<entity_handle>{ a, b }, "ordered range lookup in key order");
+
+    ecs.destroy_entity(a);
+    check(index.find(5).empty(), "ordered lookup after destroying the entity");
+}
+
+void test_unique_index(void) {
+    using index_type = unique_index<&NetIdComponent::value>;
+
+    entity_component_system ecs{};
+    ecs.register_index<index_type>();
+    const index_type& index = ecs.get_index<index_type>();
+
+    entity_handle a = ecs.create_entity();
+    entity_handle b = ecs.create_entity();
+    entity_handle c = ecs.create_entity();
+    ecs.add_component<NetIdComponent>(a, 1);
+    ecs.add_component<NetIdComponent>(b, 2);
+    check(index.find(1) == a && index.find(2) == b, "unique lookup after add");
+
+    // Two entities trade keys, neither insert may see the other's stale entry.
+    ecs.get_component<NetIdComponent>(a).value = 2;
+    ecs.get_component<NetIdComponent>(b).value = 1;
+    ecs.sync_indices<NetIdComponent>();
+    check(index.find(2) == a && index.find(1) == b, "unique lookup after swapping keys");
+
+    bool thrown = false;
+    try {
+        ecs.add_component<NetIdComponent>(c, 1);
+    }
+    catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    check(thrown, "adding a taken unique key throws");
+    check(!ecs.has_component<NetIdComponent>(c), "a rejected add leaves the pool unchanged");
+    check(index.find(1) == b, "a rejected add keeps the key with its holder");
+
+    ecs.add_component<NetIdComponent>(c, 3);
+    thrown = false;
+    try {
+        ecs.patch_component<NetIdComponent>(c, [](NetIdComponent& id) { id.value = 2; });
+    }
+    catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    check(thrown, "patching to a taken unique key throws");
+    check(index.find(2) == a, "a rejected patch keeps the key with its holder");
+
+    ecs.patch_component<NetIdComponent>(c, [](NetIdComponent& id) { id.value = 4; });
+    check(index.find(4) == c && !index.contains(3), "unique lookup after patch");
+
+    ecs.get_component<NetIdComponent>(b).value = 4;
+    thrown = false;
+    try {
+        ecs.sync_indices<NetIdComponent>();
+    }
+    catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    check(thrown, "syncing a duplicate unique key throws");
+    check(index.find(4) == c, "a rejected sync keeps the key with its holder");
+
+    ecs.get_component<NetIdComponent>(b).value = 5;
+    ecs.sync_indices<NetIdComponent>();
+    check(index.find(5) == b && !index.contains(1), "sync picks up the corrected key");
+
+    ecs.remove_component<NetIdComponent>(a);
+    check(!index.contains(2), "unique lookup after remove");
+}
+
+void test_double_buffered_index(void) {
+    using index_type = ordered_index<&HealthComponent::value>;
+
+    entity_component_system ecs{};
+    ecs.register_index<index_type>();
+
+    entity_handle a = ecs.create_entity();
+    entity_handle b = ecs.create_entity();
+    ecs.add_component<HealthComponent>(a, 10);
+    ecs.add_component<HealthComponent>(b, 20);
+
+    for (int frame = 1; frame <= 3; ++frame) {
+        std::span<const HealthComponent> previous = ecs.previous_components<HealthComponent>();
+        std::span<HealthComponent> current = ecs.current_components<HealthComponent>();
+        for (size_t index = 0; index < current.size(); ++index) {
+            current[index].value = previous[index].value + 1;
+        }
+        ecs.sync_indices<HealthComponent>();
+
+        const index_type& index = ecs.get_index<index_type>();
+        check(same_entities(index.find(10 + frame), { a }), "double buffered lookup of the written frame");
+        check(index.find(10 + frame - 1).empty(), "double buffered lookup of the replaced key");
+
+        ecs.swap_component_buffers<HealthComponent>();
+    }
+
+    // After the swap the write buffer, and so the index, holds the frame before last again.
+    const index_type& index = ecs.get_index<index_type>();
+    check(same_entities(index.find(12), { a }), "double buffered indices swap with the frames");
+    check(same_entities(index.find(22), { b }), "double buffered indices cover every entity");
+
+    ecs.patch_component<HealthComponent>(b, [](HealthComponent& health) { health.value = 50; });
+    check(same_entities(ecs.get_index<index_type>().find(50), { b }), "double buffered lookup after patch");
+
+    ecs.remove_component<HealthComponent>(b);
+    ecs.swap_component_buffers<HealthComponent>();
+    check(ecs.get_index<index_type>().find(23).empty(), "removal drops the entity from both frames");
+}
+
+int main() {
+    test_ordered_index<PackedTeamComponent>();
+    test_ordered_index<StableTeamComponent>();
+    test_ordered_index<StaticTeamComponent>();
+    test_unique_index();
+    test_double_buffered_index();
+
+    std::cout << "Index test failures: " << g_Failures << '\n';
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "rw-ecs.h"
+#include <algorithm>
+#include <iostream>
+using namespace rw::ecs;
+
+static int g_Failures = 0;
+
+static void check(bool condition, const char* message) {
+    if (!condition) {
+        std::cout << "Failed: " << message << '\n';
+        ++g_Failures;
+    }
+}
+
+static bool same_entities(std::span<const entity_handle> found, std::vector<entity_handle> expected) {
+    std::vector<entity_handle> sorted{ found.begin(), found.end() };
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(expected.begin(), expected.end());
+    return sorted == expected;
+}
+
+struct PositionComponent {
+    using storage_policy = stable_storage<4>;
+    int x, y;
+};
+
+struct TagComponent {
+    int value;
+};
+
+struct SlotComponent {
+    using storage_policy = static_storage<4>;
+    int value;
+};
+
+class MovementSystem : public component_system<MovementSystem> {
+public:
+    using component_list = std::tuple<PositionComponent, TagComponent>;
+};
+
+class SlotSystem : public component_system<SlotSystem> {
+public:
+    using component_list = std::tuple<SlotComponent>;
+};
+
+void test_merge_into_empty(void) {
+    entity_component_system source{};
+    entity_component_system destination{};
+    source.register_system<MovementSystem>();
+    destination.register_system<MovementSystem>();
+
+    std::vector<entity_handle> entities{};
+    std::vector<const PositionComponent*> addresses{};
+    for (int index = 0; index < 10; ++index) {
+        entity_handle entity = source.create_entity();
+        source.add_component<PositionComponent>(entity, index, -index);
+        source.add_component<TagComponent>(entity, index);
+        entities.push_back(entity);
+        addresses.push_back(&source.get_component<PositionComponent>(entity));
+    }
+
+    entity_remap remap = destination.merge(source);
+
+    std::vector<entity_handle> expected{};
+    for (int index = 0; index < 10; ++index) {
+        entity_handle entity = entities[index];
+        check(entity < remap.size() && remap[entity] != invalid_entity, "merge into an empty world remaps every entity");
+        if (entity >= remap.size() || remap[entity] == invalid_entity) continue;
+
+        entity_handle moved = remap[entity];
+        expected.push_back(moved);
+        check(!source.validate_entity(entity), "merged entities leave the source");
+        check(destination.get_component<PositionComponent>(moved).x == index, "merged components keep their values");
+        check(destination.get_component<TagComponent>(moved).value == index, "merged components follow their entity");
+        check(&destination.get_component<PositionComponent>(moved) == addresses[index], "stable storage keeps its addresses across the handover");
+    }
+
+    check(source.get_system<MovementSystem>().entities().empty(), "merged entities leave the source systems");
+    check(same_entities(destination.get_system<MovementSystem>().entities(), expected), "merged entities join the destination systems");
+}
+
+void test_merge_into_non_empty(void) {
+    entity_component_system source{};
+    entity_component_system destination{};
+    source.register_system<MovementSystem>();
+    destination.register_system<MovementSystem>();
+
+    entity_handle resident = destination.create_entity();
+    destination.add_component<PositionComponent>(resident, 100, 100);
+    destination.add_component<TagComponent>(resident, 100);
+
+    std::vector<entity_handle> entities{};
+    for (int index = 0; index < 6; ++index) {
+        entity_handle entity = source.create_entity();
+        source.add_component<PositionComponent>(entity, index, index);
+        if (index % 2 == 0) {
+            source.add_component<TagComponent>(entity, index);
+        }
+        entities.push_back(entity);
+    }
+
+    entity_remap remap = destination.merge(source);
+
+    std::vector<entity_handle> expected{ resident };
+    for (int index = 0; index < 6; ++index) {
+        entity_handle moved = remap[entities[index]];
+        check(moved != invalid_entity && moved != resident, "merge into a non-empty world hands out fresh ids");
+        check(destination.get_component<PositionComponent>(moved).x == index, "merged components keep their values");
+        check(destination.has_component<TagComponent>(moved) == (index % 2 == 0), "merged entities keep their component set");
+        if (index % 2 == 0) {
+            expected.push_back(moved);
+        }
+    }
+
+    check(destination.get_component<PositionComponent>(resident).x == 100, "merge leaves resident components alone");
+    check(source.get_system<MovementSystem>().entities().empty(), "merged entities leave the source systems");
+    check(same_entities(destination.get_system<MovementSystem>().entities(), expected), "merged entities join the destination systems");
+}
+
+void test_move_into_full_static_pool(void) {
+    entity_component_system source{};
+    entity_component_system destination{};
+    source.register_system<SlotSystem>();
+    destination.register_system<SlotSystem>();
+    source.register_component<TagComponent>();
+
+    for (int index = 0; index < 3; ++index) {
+        destination.add_component<SlotComponent>(destination.create_entity(), 100 + index);
+    }
+
+    std::vector<entity_handle> entities{};
+    for (int index = 0; index < 3; ++index) {
+        entity_handle entity = source.create_entity();
+        source.add_component<SlotComponent>(entity, index);
+        entities.push_back(entity);
+    }
+    entity_handle untagged = source.create_entity();
+    source.add_component<TagComponent>(untagged, 42);
+    entities.push_back(untagged);
+
+    entity_remap remap = destination.move_entities(source, entities);
+
+    // One slot is left, the first entity takes it and the rest stay behind, except the one without a static component.
+    check(remap[entities[0]] != invalid_entity, "move fills the remaining static slot");
+    check(destination.get_component<SlotComponent>(remap[entities[0]]).value == 0, "moved static components keep their values");
+    for (int index = 1; index < 3; ++index) {
+        entity_handle entity = entities[index];
+        check(remap[entity] == invalid_entity, "entities that do not fit map to invalid_entity");
+        check(source.validate_entity(entity) && source.get_component<SlotComponent>(entity).value == index, "entities that do not fit stay in the source");
+    }
+    check(remap[untagged] != invalid_entity, "entities without static components still move");
+    check(destination.get_component<TagComponent>(remap[untagged]).value == 42, "moved components keep their values");
+
+    check(same_entities(source.get_system<SlotSystem>().entities(), { entities[1], entities[2] }), "source systems keep the entities left behind");
+    check(destination.get_system<SlotSystem>().entities().size() == 4, "destination systems pick up the moved entity");
+
+    entity_remap second = destination.merge(source);
+    for (int index = 1; index < 3; ++index) {
+        check(second[entities[index]] == invalid_entity, "merge leaves entities in the source when static pools are full");
+        check(source.get_component<SlotComponent>(entities[index]).value == index, "a rejected merge leaves components untouched");
+    }
+}
+
+void test_merge_into_bounded_world(void) {
+    entity_component_system source{};
+    entity_component_system destination{ 2 };
+    source.register_system<MovementSystem>();
+    destination.register_system<MovementSystem>();
+
+    std::vector<entity_handle> entities{};
+    for (int index = 0; index < 3; ++index) {
+        entity_handle entity = source.create_entity();
+        source.add_component<PositionComponent>(entity, index, index);
+        source.add_component<TagComponent>(entity, index);
+        entities.push_back(entity);
+    }
+
+    entity_remap remap = destination.merge(source);
+
+    size_t moved = std::ranges::count_if(remap, [](entity_handle entity) { return entity != invalid_entity; });
+    check(moved == 2, "merge stops at the destination capacity");
+    check(remap[entities[2]] == invalid_entity, "entities past the capacity map to invalid_entity");
+    check(source.validate_entity(entities[2]) && source.get_component<TagComponent>(entities[2]).value == 2, "entities past the capacity stay in the source");
+
+    for (int index = 0; index < 2; ++index) {
+        check(destination.get_component<TagComponent>(remap[entities[index]]).value == index, "merged components follow their entity");
+    }
+
+    check(same_entities(source.get_system<MovementSystem>().entities(), { entities[2] }), "source systems keep the entities left behind");
+    check(same_entities(destination.get_system<MovementSystem>().entities(), { remap[entities[0]], remap[entities[1]] }), "merged entities join the destination systems");
+}
+
+int main() {
+    test_merge_into_empty();
+    test_merge_into_non_empty();
+    test_move_into_full_static_pool();
+    test_merge_into_bounded_world();
+
+    std::cout << "Merge test failures: " << g_Failures << '\n';
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file